@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "ParameterLayout.h"
 #include "PluginEditor.h"
+#include "utility/Tracer.h"
 //==============================================================================
 PluginProcessor::PluginProcessor()
   : dmt::app::AbstractPluginProcessor(createParameterLayout)
@@ -30,6 +31,7 @@ PluginProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
   juce::ignoreUnused(sampleRate, samplesPerBlock);
 
+  loadMeter.prepare(sampleRate);
   disfluxProcessor.prepare(sampleRate);
 }
 
@@ -48,6 +50,7 @@ PluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 {
   // Boilerplate
   juce::ignoreUnused(midiMessages);
+  const auto loadMeasurement = loadMeter.measure(buffer.getNumSamples());
 
   juce::ScopedNoDenormals noDenormals;
   auto totalNumInputChannels = getTotalNumInputChannels();
@@ -57,14 +60,14 @@ PluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     buffer.clear(i, 0, buffer.getNumSamples());
 
   // Start actual processing
-  TRACE_DSP();
+  DSP_TRACER_BLOCK("PluginProcessor::processBlock");
   const auto* bypassParam = apvts.getRawParameterValue("GlobalBypass");
   bool isBypassed = bypassParam->load() > 0.5f;
 
   if (!isBypassed) {
     disfluxProcessor.processBlock(buffer);
   }
-  oscilloscopeBuffer.addToFifo(buffer);
+  oscilloscopeBuffer.write(buffer);
 }
 
 //==============================================================================
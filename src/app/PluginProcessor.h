@@ -22,7 +22,7 @@ public:
   juce::AudioProcessorEditor* createEditor() override;
 
   //==============================================================================
-  dmt::dsp::data::FifoAudioBuffer<float> oscilloscopeBuffer;
+  dmt::dsp::data::BroadcastAudioBuffer<float, int16_t> oscilloscopeBuffer;
   dmt::dsp::effect::DisfluxProcessor disfluxProcessor;
 
 private:
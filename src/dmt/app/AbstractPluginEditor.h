@@ -2,6 +2,7 @@
 
 #include "./AbstractPluginProcessor.h"
 #include "gui/window/Compositor.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 #include <functional>
 
@@ -31,7 +32,12 @@ public:
     , baseHeight(_baseHeight)
     , sizeFactor(p.sizeFactor)
     , mainLayout({}, {})
-    , compositor(_name, mainLayout, p.apvts, p.properties, sizeFactor)
+    , compositor(_name,
+                 mainLayout,
+                 p.apvts,
+                 p.properties,
+                 p.loadMeter,
+                 sizeFactor)
     , compositorAttached(true)
   {
     // Initialize the layout via strategy function
@@ -104,7 +110,7 @@ public:
 
   void paint(juce::Graphics& g)
   {
-    TRACER("PluginEditor::paint");
+    GUI_TRACER_BLOCK("PluginEditor::paint");
 
     // Just painting the background
     g.fillAll(dmt::Settings::Window::backgroundColour);
@@ -120,7 +126,7 @@ public:
 
   void resized()
   {
-    TRACER("PluginEditor::resized");
+    GUI_TRACER_COMPONENT("PluginEditor::resized");
 
     // Set the global size
     const int currentHeight = getHeight();
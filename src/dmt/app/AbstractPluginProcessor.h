@@ -1,6 +1,9 @@
 #pragma once
 
 #include "configuration/Properties.h"
+#include "utility/FlightRecorder.h"
+#include "utility/LoadMeter.h"
+#include "utility/LogWriter.h"
 #include "version/Manager.h"
 #include <JuceHeader.h>
 
@@ -150,6 +153,8 @@ public:
   //==============================================================================
   dmt::configuration::Properties properties;
   dmt::version::Manager versionManager;
+  juce::SharedResourcePointer<dmt::utility::LogWriter> logWriter;
+  dmt::utility::LoadMeter loadMeter;
 
   //==============================================================================
   float sizeFactor = 1.0f;
@@ -159,7 +164,7 @@ public:
   //==============================================================================
 private:
 #if PERFETTO
-  std::unique_ptr<perfetto::TracingSession> tracingSession;
+  dmt::utility::FlightRecorder flightRecorder{ loadMeter };
 #endif
 
   //==============================================================================
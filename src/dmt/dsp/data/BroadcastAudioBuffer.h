@@ -0,0 +1,613 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * This file is part of the Dimethoxy Library, a collection of essential
+ * classes used across various Dimethoxy projects.
+ * These files are primarily designed for internal use within our repositories.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * A lock-free single-writer multi-reader audio buffer. The audio thread writes
+ * every block exactly once and any number of readers consume it through their
+ * own cursors, reading directly from the shared storage. The stream can be
+ * stored at reduced precision and decimated to min/max pairs to save memory
+ * bandwidth between the audio and the GUI thread.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "dsp/data/MirroredAudioBuffer.h"
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace data {
+
+//==============================================================================
+/**
+ * @brief A lock-free broadcast buffer for analysis taps.
+ *
+ * @tparam SampleType The type of audio sample (e.g., float, double).
+ * @tparam StorageType The type the stream is stored as. Integer types store
+ * the samples as fixed point with HEADROOM of headroom above full scale.
+ * Samples beyond +/-HEADROOM are clipped to it, so integer taps are only
+ * meant for display, not for measuring signals that can get that hot.
+ *
+ * @details
+ * The writer owns a monotonic 64-bit write cursor and never waits for
+ * readers. Each reader keeps its own cursor and reads spans that point
+ * straight into the shared storage. A reader that falls more than one
+ * capacity behind skips ahead and loses the oldest samples instead of
+ * blocking the writer.
+ *
+ * Because the writer doesn't know about readers, a slow reader can have its
+ * spans overwritten while it is still reading them. This is detected with a
+ * second cursor that the writer bumps before touching the storage. Reader::
+ * release() reports such a view as torn, and the caller can throw it away.
+ *
+ * The storage is mirrored, so a span never wraps around. The capacity is
+ * rounded up to a power of two so that positions can be masked instead of
+ * wrapped with a modulo.
+ *
+ * The buffer counts its readers. While none is attached, write() returns
+ * right away, so a tap without a visible consumer (e.g. a closed editor)
+ * costs nothing on the audio thread. A reader attaching later starts at the
+ * current write cursor, so its history simply starts fresh.
+ *
+ * A reader that doesn't need every sample can request a decimation factor.
+ * The writer then reduces every group of that many samples to its minimum
+ * and maximum, stored in the order they occurred, so the stream carries two
+ * values per group. A factor of 2 is therefore still lossless. The cursors
+ * count stored values, not input samples. Since all readers share one
+ * stream, the writer uses the finest factor requested by any attached
+ * reader, and a reader that never requests one keeps the stream lossless.
+ * Readers therefore have to handle a finer factor than they asked for. The
+ * factor only changes between blocks, and readers skip the values stored
+ * with the old factor.
+ *
+ * The writer also remembers the cursor of the last block that wasn't silent,
+ * so consumers can stop updating once they have shown enough silence.
+ */
+template<typename SampleType, typename StorageType = SampleType>
+class alignas(64) BroadcastAudioBuffer
+{
+  using AudioBuffer = juce::AudioBuffer<SampleType>;
+  using MirroredAudioBuffer = dmt::dsp::data::MirroredAudioBuffer<StorageType>;
+
+  constexpr static int MAX_DECIMATION_SHIFT = 12;
+  constexpr static int DECIMATION_BITS = 8;
+
+public:
+  constexpr static SampleType HEADROOM = static_cast<SampleType>(2.0);
+
+  // Blocks below this magnitude (about -80 dB) count as silent
+  constexpr static SampleType SILENCE_THRESHOLD =
+    static_cast<SampleType>(0.0001);
+
+  //============================================================================
+  /**
+   * @brief A range of values acquired by a reader.
+   */
+  struct View
+  {
+    uint64_t start = 0;
+    int numSamples = 0;
+    int decimation = 1;
+  };
+
+  //============================================================================
+  /**
+   * @brief A consumer with its own read cursor.
+   *
+   * @details
+   * Readers are meant to be used from a single consumer thread each. They
+   * start at the current write position, so they only see samples written
+   * after their construction. The buffer is only written while at least one
+   * reader exists.
+   */
+  class Reader
+  {
+  public:
+    using Source = BroadcastAudioBuffer;
+
+    //==========================================================================
+    /**
+     * @brief Constructs a reader for the given buffer.
+     *
+     * @param _source The buffer to read from.
+     */
+    explicit Reader(const BroadcastAudioBuffer& _source) noexcept
+      : source(_source)
+    {
+      source.decimationRequests[0].fetch_add(1, std::memory_order_relaxed);
+      source.numReaders.fetch_add(1, std::memory_order_acq_rel);
+      cursor = source.getWriteCursor();
+    }
+
+    //==========================================================================
+    /**
+     * @brief Detaches the reader from the buffer.
+     */
+    ~Reader() noexcept
+    {
+      source.decimationRequests[decimationShift].fetch_sub(
+        1, std::memory_order_relaxed);
+      source.numReaders.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    //==========================================================================
+    /**
+     * @brief Requests a decimation factor for the following blocks.
+     *
+     * @param _decimation The number of samples per min/max pair. It is rounded
+     * down to a power of two, and 1 disables decimation.
+     *
+     * @details
+     * The writer applies the finest factor requested by any reader at the
+     * start of its next block, so the views may still come with a finer
+     * factor than requested.
+     */
+    inline void setDecimation(const int _decimation) noexcept
+    {
+      const int clamped =
+        std::clamp(_decimation, 1, 1 << MAX_DECIMATION_SHIFT);
+      const int newShift =
+        juce::findHighestSetBit(static_cast<uint32_t>(clamped));
+      if (newShift == decimationShift)
+        return;
+
+      source.decimationRequests[newShift].fetch_add(1,
+                                                    std::memory_order_relaxed);
+      source.decimationRequests[decimationShift].fetch_sub(
+        1, std::memory_order_relaxed);
+      decimationShift = newShift;
+    }
+
+    //==========================================================================
+    /**
+     * @brief Acquires all values written since the last release.
+     *
+     * @param _maxSamples The maximum number of values to acquire. If more
+     * are available, only the newest ones are acquired and the rest is lost.
+     * @return The acquired range of values and their decimation factor.
+     */
+    [[nodiscard]] forcedinline View acquire(const int _maxSamples) noexcept
+    {
+      // The writer publishes a decimation change before it advances the write
+      // cursor, so loading the cursor first guarantees that every change up to
+      // it is visible. A change seen here may also be newer than the cursor.
+      const uint64_t writeCursor = source.getWriteCursor();
+      const uint64_t decimationChange =
+        source.decimationChange.load(std::memory_order_acquire);
+      const uint64_t limit = static_cast<uint64_t>(
+        std::clamp(_maxSamples, 0, source.getCapacity()));
+
+      // Values stored with the previous decimation are useless to the reader
+      const int newDecimation = 1 << (decimationChange & DECIMATION_MASK);
+      if (newDecimation != decimation) [[unlikely]] {
+        const uint64_t changeCursor =
+          std::min(decimationChange >> DECIMATION_BITS, writeCursor);
+        if (changeCursor > cursor) {
+          numLostSamples += changeCursor - cursor;
+          cursor = changeCursor;
+        }
+        decimation = newDecimation;
+      }
+
+      if (writeCursor - cursor > limit) [[unlikely]] {
+        numLostSamples += writeCursor - limit - cursor;
+        cursor = writeCursor - limit;
+      }
+
+      return { cursor, static_cast<int>(writeCursor - cursor), decimation };
+    }
+
+    //==========================================================================
+    /**
+     * @brief Gets the values of one channel of an acquired view.
+     *
+     * @param _view The view returned by acquire().
+     * @param _channel The channel to get the values for.
+     * @return The span holding the values of the view.
+     */
+    [[nodiscard]] forcedinline std::span<const StorageType> getSpan(
+      const View& _view,
+      const int _channel) const noexcept
+    {
+      return source.getSpan(_channel, _view.start, _view.numSamples);
+    }
+
+    //==========================================================================
+    /**
+     * @brief Releases a view and moves the cursor past it.
+     *
+     * @param _view The view returned by acquire().
+     * @return False if the writer overwrote part of the view while it was
+     * being read, in which case the data read from it is torn.
+     */
+    [[nodiscard]] forcedinline bool release(const View& _view) noexcept
+    {
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const uint64_t pendingCursor =
+        source.pendingCursor.load(std::memory_order_relaxed);
+      const uint64_t capacity = static_cast<uint64_t>(source.getCapacity());
+      cursor = _view.start + static_cast<uint64_t>(_view.numSamples);
+
+      if (pendingCursor - _view.start > capacity) [[unlikely]] {
+        numLostSamples += static_cast<uint64_t>(_view.numSamples);
+        return false;
+      }
+      return true;
+    }
+
+    //==========================================================================
+    /**
+     * @brief Checks whether values were written since the last release.
+     *
+     * @return True if the next acquire() would return any values.
+     */
+    [[nodiscard]] inline bool hasPendingSamples() const noexcept
+    {
+      return source.getWriteCursor() != cursor;
+    }
+
+    //==========================================================================
+    /**
+     * @brief Gets the number of silent values released by this reader.
+     *
+     * @return The number of values released since the last block that wasn't
+     * silent, or 0 if that block is still pending.
+     */
+    [[nodiscard]] inline uint64_t getNumSilentValues() const noexcept
+    {
+      const uint64_t activeCursor =
+        source.activeCursor.load(std::memory_order_relaxed);
+      return cursor - std::min(cursor, activeCursor);
+    }
+
+    //==========================================================================
+    /**
+     * @brief Gets the number of values this reader has lost so far.
+     *
+     * @return The number of lost values.
+     */
+    [[nodiscard]] inline uint64_t getNumLostSamples() const noexcept
+    {
+      return numLostSamples;
+    }
+
+    //==========================================================================
+    /**
+     * @brief Gets the number of channels of the source buffer.
+     *
+     * @return The number of channels.
+     */
+    [[nodiscard]] inline int getNumChannels() const noexcept
+    {
+      return source.getNumChannels();
+    }
+
+  private:
+    const BroadcastAudioBuffer& source;
+    uint64_t cursor = 0;
+    uint64_t numLostSamples = 0;
+    int decimation = 1;
+    int decimationShift = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Reader)
+  };
+
+  //============================================================================
+  /**
+   * @brief Constructs a BroadcastAudioBuffer.
+   *
+   * @param _numChannels The number of audio channels.
+   * @param _minCapacity The minimum number of values per channel. It is
+   * rounded up to the next power of two.
+   */
+  BroadcastAudioBuffer(const int _numChannels, const int _minCapacity) noexcept
+    : storage(_numChannels, _minCapacity)
+    , mask(static_cast<uint64_t>(storage.getNumSamples() - 1))
+    , scratch(static_cast<size_t>(storage.getNumSamples()))
+    , groups(static_cast<size_t>(std::max(_numChannels, 0)))
+  {
+  }
+
+  //============================================================================
+  /**
+   * @brief Writes a block of audio. Must only be called by the writer.
+   *
+   * @param _bufferToWrite The audio block to broadcast.
+   *
+   * @details
+   * Does nothing while no reader is attached. Channels beyond the capacity of
+   * the buffer are ignored. If the block produces more values than the
+   * capacity, the older ones are overwritten right away, but the cursor still
+   * advances by all of them so readers stay in sync.
+   */
+  forcedinline void write(const AudioBuffer& _bufferToWrite) noexcept
+  {
+    if (!hasReaders()) [[unlikely]]
+      return;
+
+    DSP_TRACER_BLOCK("BroadcastAudioBuffer::write");
+
+    const uint64_t currentCursor = writeCursor.load(std::memory_order_relaxed);
+    updateDecimation(currentCursor);
+
+    const int numSamples = _bufferToWrite.getNumSamples();
+    const int numChannels =
+      std::min(_bufferToWrite.getNumChannels(), getNumChannels());
+    const int numValues =
+      decimation == 1 ? numSamples
+                      : (groupPosition + numSamples) / decimation * 2;
+
+    const uint64_t newWriteCursor =
+      currentCursor + static_cast<uint64_t>(numValues);
+    pendingCursor.store(newWriteCursor, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Every chunk produces at most as many values as it has samples
+    const int chunkSize = getCapacity();
+    int newGroupPosition = groupPosition;
+    for (int channel = 0; channel < numChannels; ++channel) {
+      const SampleType* source = _bufferToWrite.getReadPointer(channel);
+      int position = static_cast<int>(currentCursor & mask);
+      newGroupPosition = groupPosition;
+      for (int start = 0; start < numSamples; start += chunkSize) {
+        const int count = std::min(chunkSize, numSamples - start);
+        const int numChunkValues =
+          decimation == 1 ? convertChunk(source + start, count)
+                          : decimateChunk(source + start,
+                                          count,
+                                          groups[channel],
+                                          newGroupPosition);
+        storage.write(channel, position, scratch.data(), numChunkValues);
+        position += numChunkValues;
+      }
+    }
+    groupPosition = newGroupPosition;
+
+    if (_bufferToWrite.getMagnitude(0, numSamples) > SILENCE_THRESHOLD)
+      activeCursor.store(newWriteCursor, std::memory_order_relaxed);
+    writeCursor.store(newWriteCursor, std::memory_order_release);
+  }
+
+  //============================================================================
+  /**
+   * @brief Converts a sample to the storage type.
+   *
+   * @param _sample The sample to convert.
+   * @return The stored value. Integer types clip it to +/-HEADROOM.
+   */
+  [[nodiscard]] forcedinline static StorageType toStorage(
+    const SampleType _sample) noexcept
+  {
+    if constexpr (std::is_integral_v<StorageType>) {
+      constexpr SampleType scale =
+        static_cast<SampleType>(std::numeric_limits<StorageType>::max()) /
+        HEADROOM;
+      const SampleType clamped = std::clamp(_sample, -HEADROOM, HEADROOM);
+      return static_cast<StorageType>(std::lrint(clamped * scale));
+    } else {
+      return static_cast<StorageType>(_sample);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Converts a stored value back to a sample.
+   *
+   * @param _value The stored value.
+   * @return The sample.
+   */
+  [[nodiscard]] forcedinline static SampleType toSample(
+    const StorageType _value) noexcept
+  {
+    if constexpr (std::is_integral_v<StorageType>) {
+      constexpr SampleType scale =
+        HEADROOM /
+        static_cast<SampleType>(std::numeric_limits<StorageType>::max());
+      return static_cast<SampleType>(_value) * scale;
+    } else {
+      return static_cast<SampleType>(_value);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Checks if any reader is attached.
+   *
+   * @return True if at least one reader exists.
+   */
+  [[nodiscard]] forcedinline bool hasReaders() const noexcept
+  {
+    return numReaders.load(std::memory_order_relaxed) > 0;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the total number of values written so far.
+   *
+   * @return The write cursor.
+   */
+  [[nodiscard]] forcedinline uint64_t getWriteCursor() const noexcept
+  {
+    return writeCursor.load(std::memory_order_acquire);
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of channels.
+   *
+   * @return The number of channels.
+   */
+  [[nodiscard]] forcedinline int getNumChannels() const noexcept
+  {
+    return storage.getNumChannels();
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of values stored per channel.
+   *
+   * @return The capacity, which is always a power of two.
+   */
+  [[nodiscard]] forcedinline int getCapacity() const noexcept
+  {
+    return storage.getNumSamples();
+  }
+
+private:
+  constexpr static uint64_t DECIMATION_MASK = (1 << DECIMATION_BITS) - 1;
+
+  //============================================================================
+  /**
+   * @brief The state of the min/max group that is being collected.
+   */
+  struct Group
+  {
+    SampleType minimum = static_cast<SampleType>(0.0);
+    SampleType maximum = static_cast<SampleType>(0.0);
+    int minIndex = 0;
+    int maxIndex = 0;
+  };
+
+  //============================================================================
+  /**
+   * @brief Applies the finest requested decimation factor. Only called by the
+   * writer.
+   *
+   * @param _cursor The write cursor the new factor starts at.
+   */
+  forcedinline void updateDecimation(const uint64_t _cursor) noexcept
+  {
+    int shift = 0;
+    while (shift < MAX_DECIMATION_SHIFT &&
+           decimationRequests[shift].load(std::memory_order_relaxed) == 0)
+      ++shift;
+    if ((1 << shift) == decimation) [[likely]]
+      return;
+
+    decimation = 1 << shift;
+    groupPosition = 0;
+    decimationChange.store((_cursor << DECIMATION_BITS) |
+                             static_cast<uint64_t>(shift),
+                           std::memory_order_release);
+  }
+
+  //============================================================================
+  /**
+   * @brief Converts a chunk of samples into the scratch buffer.
+   *
+   * @param _source The samples.
+   * @param _numSamples The number of samples.
+   * @return The number of values written to the scratch buffer.
+   */
+  forcedinline int convertChunk(const SampleType* _source,
+                                const int _numSamples) noexcept
+  {
+    std::transform(_source, _source + _numSamples, scratch.begin(), toStorage);
+    return _numSamples;
+  }
+
+  //============================================================================
+  /**
+   * @brief Reduces a chunk of samples to min/max pairs in the scratch buffer.
+   *
+   * @param _source The samples.
+   * @param _numSamples The number of samples.
+   * @param _group The group state of the channel.
+   * @param _position The position within the current group.
+   * @return The number of values written to the scratch buffer.
+   */
+  forcedinline int decimateChunk(const SampleType* _source,
+                                 const int _numSamples,
+                                 Group& _group,
+                                 int& _position) noexcept
+  {
+    int numValues = 0;
+    for (int i = 0; i < _numSamples; ++i) {
+      const SampleType sample = _source[i];
+      if (_position == 0) {
+        _group = { sample, sample, 0, 0 };
+      } else if (sample < _group.minimum) {
+        _group.minimum = sample;
+        _group.minIndex = _position;
+      } else if (sample > _group.maximum) {
+        _group.maximum = sample;
+        _group.maxIndex = _position;
+      }
+
+      if (++_position == decimation) {
+        const bool minFirst = _group.minIndex <= _group.maxIndex;
+        scratch[static_cast<size_t>(numValues++)] =
+          toStorage(minFirst ? _group.minimum : _group.maximum);
+        scratch[static_cast<size_t>(numValues++)] =
+          toStorage(minFirst ? _group.maximum : _group.minimum);
+        _position = 0;
+      }
+    }
+    return numValues;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the values of a range of one channel.
+   *
+   * @param _channel The channel index.
+   * @param _start The cursor of the first value.
+   * @param _numSamples The number of values.
+   * @return The span holding the range.
+   */
+  [[nodiscard]] forcedinline std::span<const StorageType> getSpan(
+    const int _channel,
+    const uint64_t _start,
+    const int _numSamples) const noexcept
+  {
+    const int position = static_cast<int>(_start & mask);
+    return { storage.getReadPointer(_channel, position),
+             static_cast<size_t>(_numSamples) };
+  }
+
+  //============================================================================
+  MirroredAudioBuffer storage;
+  const uint64_t mask;
+  std::vector<StorageType> scratch;
+  std::vector<Group> groups;
+  int decimation = 1;
+  int groupPosition = 0;
+  alignas(64) std::atomic<uint64_t> writeCursor{ 0 };
+  alignas(64) std::atomic<uint64_t> pendingCursor{ 0 };
+  alignas(64) std::atomic<uint64_t> activeCursor{ 0 };
+  alignas(64) std::atomic<uint64_t> decimationChange{ 0 };
+  alignas(64) mutable std::array<std::atomic<int>, MAX_DECIMATION_SHIFT + 1>
+    decimationRequests{};
+  alignas(64) mutable std::atomic<int> numReaders{ 0 };
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BroadcastAudioBuffer)
+};
+
+} // namespace data
+} // namespace dsp
+} // namespace dmt
@@ -29,7 +29,10 @@
 
 //==============================================================================
 
+#include "./BroadcastAudioBuffer.h"
 #include "./FifoAudioBuffer.h"
+#include "./MinMaxPyramid.h"
+#include "./MirroredAudioBuffer.h"
 #include "./RingAudioBuffer.h"
 #include "./RingBufferInterface.h"
 
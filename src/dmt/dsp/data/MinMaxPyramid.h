@@ -0,0 +1,310 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * A multi-resolution min/max summary of an audio stream. It is updated as
+ * samples arrive, so waveform displays can draw any zoom level from a long
+ * history at a cost proportional to their pixel width.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "dsp/data/MirroredAudioBuffer.h"
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace data {
+
+//==============================================================================
+/**
+ * @brief A min/max mipmap pyramid over the history of an audio stream.
+ *
+ * @tparam SampleType The type of audio sample (e.g., float, double).
+ *
+ * @details
+ * Every level stores the minimum and maximum of consecutive bins of samples.
+ * The bins of the first level span 16 samples and every following level
+ * combines 16 bins of the level below, giving 16, 256 and 4096 samples per
+ * bin. Bins are indexed by their absolute position in the stream, which is the
+ * sample cursor divided by the bin size.
+ *
+ * The pyramid reads new samples from the mirrored storage of a ring buffer,
+ * which is why it doesn't need to buffer partial bins itself. Only completed
+ * bins are stored, and each one is computed exactly once.
+ *
+ * The minima and maxima are kept in separate mirrored buffers, so a range of
+ * bins is always contiguous and can be scanned without wrap-around logic.
+ */
+template<typename SampleType>
+class alignas(64) MinMaxPyramid
+{
+  using MirroredAudioBuffer = dmt::dsp::data::MirroredAudioBuffer<SampleType>;
+
+public:
+  constexpr static int NUM_LEVELS = 3;
+  constexpr static int LEVEL_SHIFT = 4;
+  constexpr static int MIN_BIN_SIZE = 1 << LEVEL_SHIFT;
+
+  //============================================================================
+  /**
+   * @brief Constructs a MinMaxPyramid.
+   *
+   * @param _numChannels The number of channels.
+   * @param _numHistorySamples The minimum number of samples every level
+   * covers.
+   */
+  MinMaxPyramid(const int _numChannels, const int _numHistorySamples) noexcept
+    : levels{ Level(_numChannels, _numHistorySamples >> (LEVEL_SHIFT * 1)),
+              Level(_numChannels, _numHistorySamples >> (LEVEL_SHIFT * 2)),
+              Level(_numChannels, _numHistorySamples >> (LEVEL_SHIFT * 3)) }
+  {
+  }
+
+  //============================================================================
+  /**
+   * @brief Adds all completed bins up to the given write cursor.
+   *
+   * @param _samples The mirrored storage of the ring buffer.
+   * @param _writeCursor The number of samples written to the storage so far.
+   *
+   * @details
+   * Samples the storage has already overwritten are left out of their bin.
+   */
+  inline void update(const MirroredAudioBuffer& _samples,
+                     const uint64_t _writeCursor) noexcept
+  {
+    DSP_TRACER_COMPONENT("MinMaxPyramid::update");
+    const uint64_t numSamples = static_cast<uint64_t>(_samples.getNumSamples());
+    const uint64_t oldestCursor =
+      _writeCursor > numSamples ? _writeCursor - numSamples : 0;
+    const uint64_t endCursor = _writeCursor & ~uint64_t{ MIN_BIN_SIZE - 1 };
+    const int numChannels =
+      std::min(_samples.getNumChannels(), getNumChannels());
+
+    // Skip bins that were overwritten entirely before they could be added
+    if (oldestCursor >= cursor + MIN_BIN_SIZE) [[unlikely]]
+      cursor = oldestCursor & ~uint64_t{ MIN_BIN_SIZE - 1 };
+
+    const uint64_t mask = numSamples - 1;
+    while (cursor < endCursor) {
+      const uint64_t firstCursor = std::max(cursor, oldestCursor);
+      const int count = static_cast<int>(cursor + MIN_BIN_SIZE - firstCursor);
+      const uint64_t bin = cursor >> LEVEL_SHIFT;
+      const int position = static_cast<int>(firstCursor & mask);
+
+      for (int channel = 0; channel < numChannels; ++channel) {
+        const SampleType* data = _samples.getReadPointer(channel, position);
+        const auto [minimum, maximum] = std::minmax_element(data, data + count);
+        levels[0].store(channel, bin, *minimum, *maximum);
+      }
+
+      cursor += MIN_BIN_SIZE;
+      for (int level = 1; level < NUM_LEVELS; ++level) {
+        if (cursor % static_cast<uint64_t>(getBinSize(level)) != 0)
+          break;
+        reduce(level, numChannels);
+      }
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Clears all levels.
+   *
+   * @param _cursor The cursor the next update starts from.
+   */
+  inline void reset(const uint64_t _cursor = 0) noexcept
+  {
+    for (auto& level : levels) {
+      level.minima.clear();
+      level.maxima.clear();
+    }
+    cursor = _cursor & ~uint64_t{ MIN_BIN_SIZE - 1 };
+  }
+
+  //============================================================================
+  /**
+   * @brief Finds the coarsest level that is still finer than a pixel.
+   *
+   * @param _samplesPerPixel The number of samples per pixel.
+   * @return The level index, or -1 if raw samples should be used.
+   */
+  [[nodiscard]] forcedinline int getLevelFor(
+    const float _samplesPerPixel) const noexcept
+  {
+    int level = -1;
+    while (level + 1 < NUM_LEVELS &&
+           static_cast<float>(getBinSize(level + 1)) <= _samplesPerPixel)
+      ++level;
+    return level;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of samples a bin of a level spans.
+   *
+   * @param _level The level index.
+   * @return The bin size in samples.
+   */
+  [[nodiscard]] constexpr static int getBinSize(const int _level) noexcept
+  {
+    return 1 << (LEVEL_SHIFT * (_level + 1));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the absolute index of the first bin that is not completed.
+   *
+   * @param _level The level index.
+   * @return The bin index. All bins before it are available, as long as they
+   * are within getNumBins().
+   */
+  [[nodiscard]] forcedinline uint64_t getEndBin(const int _level) const noexcept
+  {
+    return cursor >> (LEVEL_SHIFT * (_level + 1));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of bins a level keeps.
+   *
+   * @param _level The level index.
+   * @return The number of bins.
+   */
+  [[nodiscard]] forcedinline int getNumBins(const int _level) const noexcept
+  {
+    return levels[static_cast<size_t>(_level)].minima.getNumSamples();
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the minima of a range of bins.
+   *
+   * @param _level The level index.
+   * @param _channel The channel index.
+   * @param _bin The absolute index of the first bin.
+   * @return A pointer that is contiguous for getNumBins() bins.
+   */
+  [[nodiscard]] forcedinline const SampleType* getMinima(
+    const int _level,
+    const int _channel,
+    const uint64_t _bin) const noexcept
+  {
+    return levels[static_cast<size_t>(_level)].minima.getReadPointer(
+      _channel, static_cast<int>(_bin));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the maxima of a range of bins.
+   *
+   * @param _level The level index.
+   * @param _channel The channel index.
+   * @param _bin The absolute index of the first bin.
+   * @return A pointer that is contiguous for getNumBins() bins.
+   */
+  [[nodiscard]] forcedinline const SampleType* getMaxima(
+    const int _level,
+    const int _channel,
+    const uint64_t _bin) const noexcept
+  {
+    return levels[static_cast<size_t>(_level)].maxima.getReadPointer(
+      _channel, static_cast<int>(_bin));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of channels.
+   *
+   * @return The number of channels.
+   */
+  [[nodiscard]] forcedinline int getNumChannels() const noexcept
+  {
+    return levels[0].minima.getNumChannels();
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief The minima and maxima of one resolution.
+   */
+  struct Level
+  {
+    Level(const int _numChannels, const int _numBins) noexcept
+      : minima(_numChannels, _numBins)
+      , maxima(_numChannels, _numBins)
+    {
+    }
+
+    forcedinline void store(const int _channel,
+                            const uint64_t _bin,
+                            const SampleType _minimum,
+                            const SampleType _maximum) noexcept
+    {
+      const int position = static_cast<int>(_bin);
+      minima.write(_channel, position, &_minimum, 1);
+      maxima.write(_channel, position, &_maximum, 1);
+    }
+
+    MirroredAudioBuffer minima;
+    MirroredAudioBuffer maxima;
+  };
+
+  //============================================================================
+  /**
+   * @brief Combines the last completed bins of the level below into one bin.
+   *
+   * @param _level The level to add the bin to.
+   * @param _numChannels The number of channels to update.
+   */
+  inline void reduce(const int _level, const int _numChannels) noexcept
+  {
+    const uint64_t bin = getEndBin(_level) - 1;
+    const uint64_t firstChild = bin << LEVEL_SHIFT;
+    for (int channel = 0; channel < _numChannels; ++channel) {
+      const SampleType* minima = getMinima(_level - 1, channel, firstChild);
+      const SampleType* maxima = getMaxima(_level - 1, channel, firstChild);
+      levels[static_cast<size_t>(_level)].store(
+        channel,
+        bin,
+        *std::min_element(minima, minima + MIN_BIN_SIZE),
+        *std::max_element(maxima, maxima + MIN_BIN_SIZE));
+    }
+  }
+
+  //============================================================================
+  std::array<Level, NUM_LEVELS> levels;
+  uint64_t cursor = 0;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MinMaxPyramid)
+};
+
+} // namespace data
+} // namespace dsp
+} // namespace dmt
@@ -0,0 +1,358 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Multi-channel sample storage for ring buffers whose windows never wrap. On
+ * Linux every channel is mapped twice in a row, so the memory behind the end
+ * of a channel is the channel itself. Elsewhere writes are mirrored by hand.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#if defined(CMAKE_OS_IS_LINUX) && CMAKE_OS_IS_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace data {
+
+//==============================================================================
+/**
+ * @brief Ring storage where any window of up to capacity samples is
+ * contiguous.
+ *
+ * @tparam SampleType The type of audio sample (e.g., float, double).
+ *
+ * @details
+ * Every channel owns twice its capacity of address space. The second half is
+ * a mirror of the first, so a pointer to any position stays valid for a full
+ * capacity of samples. Readers and SIMD reductions can run straight over raw
+ * pointers without any wrap-around logic.
+ *
+ * On Linux the mirror is created with a memfd whose pages are mapped twice
+ * back to back. Writing to either half writes to both, so every sample is
+ * stored only once. If the mapping isn't available, or on other platforms,
+ * the buffer falls back to plain memory and writes everything to both halves.
+ *
+ * The capacity is rounded up to a power of two, and to at least one page per
+ * channel, so positions can be masked instead of wrapped with a modulo.
+ */
+template<typename SampleType>
+class alignas(64) MirroredAudioBuffer
+{
+public:
+  //============================================================================
+  /**
+   * @brief Constructs a MirroredAudioBuffer.
+   *
+   * @param _numChannels The number of channels.
+   * @param _minNumSamples The minimum number of samples per channel.
+   */
+  MirroredAudioBuffer(const int _numChannels, const int _minNumSamples) noexcept
+  {
+    allocate(_numChannels, _minNumSamples);
+  }
+
+  //============================================================================
+  ~MirroredAudioBuffer() noexcept { release(); }
+
+  //============================================================================
+  /**
+   * @brief Reallocates the buffer. All samples are cleared.
+   *
+   * @param _numChannels The new number of channels.
+   * @param _minNumSamples The new minimum number of samples per channel.
+   */
+  inline void setSize(const int _numChannels, const int _minNumSamples) noexcept
+  {
+    release();
+    allocate(_numChannels, _minNumSamples);
+  }
+
+  //============================================================================
+  /**
+   * @brief Writes samples to one channel.
+   *
+   * @param _channel The channel to write to.
+   * @param _position The position of the first sample. It is wrapped, so any
+   * position can be passed.
+   * @param _source The samples to write.
+   * @param _numSamples The number of samples. Must not exceed the capacity.
+   */
+  forcedinline void write(const int _channel,
+                          const int _position,
+                          const SampleType* _source,
+                          const int _numSamples) noexcept
+  {
+    write(_channel, _position, _source, _numSamples, [](SampleType _sample) {
+      return _sample;
+    });
+  }
+
+  //============================================================================
+  /**
+   * @brief Converts samples of another type and writes them to one channel.
+   *
+   * @param _channel The channel to write to.
+   * @param _position The position of the first sample. It is wrapped, so any
+   * position can be passed.
+   * @param _source The samples to write.
+   * @param _numSamples The number of samples. Must not exceed the capacity.
+   * @param _convert Converts one source sample to a SampleType.
+   */
+  template<typename SourceType, typename Converter>
+  forcedinline void write(const int _channel,
+                          const int _position,
+                          const SourceType* _source,
+                          const int _numSamples,
+                          Converter&& _convert) noexcept
+  {
+    jassert(_numSamples <= numSamples);
+    if (_numSamples <= 0) [[unlikely]]
+      return;
+
+    SampleType* channelData = getChannelData(_channel);
+    const int start = _position & mask;
+    std::transform(
+      _source, _source + _numSamples, channelData + start, _convert);
+
+    if (mirrored) [[likely]]
+      return;
+
+    // The copy above already filled the mirror of the wrapped part
+    const int firstSize = std::min(_numSamples, numSamples - start);
+    std::copy_n(
+      channelData + start, firstSize, channelData + start + numSamples);
+    if (_numSamples > firstSize)
+      std::copy_n(channelData + numSamples,
+                  _numSamples - firstSize,
+                  channelData);
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets a pointer to the samples of a channel.
+   *
+   * @param _channel The channel index.
+   * @param _position The position of the first sample. It is wrapped, so any
+   * position can be passed.
+   * @return A pointer that is valid for getNumSamples() samples.
+   */
+  [[nodiscard]] forcedinline const SampleType* getReadPointer(
+    const int _channel,
+    const int _position = 0) const noexcept
+  {
+    return data + static_cast<size_t>(_channel) * channelStride +
+           static_cast<size_t>(_position & mask);
+  }
+
+  //============================================================================
+  /**
+   * @brief Sets all samples to zero.
+   */
+  inline void clear() noexcept
+  {
+    if (data != nullptr)
+      std::fill_n(data, static_cast<size_t>(numChannels) * channelStride, 0);
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of channels.
+   *
+   * @return The number of channels.
+   */
+  [[nodiscard]] forcedinline int getNumChannels() const noexcept
+  {
+    return numChannels;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of samples per channel.
+   *
+   * @return The capacity, which is always a power of two.
+   */
+  [[nodiscard]] forcedinline int getNumSamples() const noexcept
+  {
+    return numSamples;
+  }
+
+  //============================================================================
+  /**
+   * @brief Checks if the mirror is backed by a virtual memory mapping.
+   *
+   * @return True if writes are stored once, false if they are copied twice.
+   */
+  [[nodiscard]] inline bool isMirrored() const noexcept { return mirrored; }
+
+private:
+  //============================================================================
+  /**
+   * @brief Gets a writable pointer to the start of a channel.
+   *
+   * @param _channel The channel index.
+   * @return The pointer to the first sample of the channel.
+   */
+  [[nodiscard]] forcedinline SampleType* getChannelData(
+    const int _channel) noexcept
+  {
+    return data + static_cast<size_t>(_channel) * channelStride;
+  }
+
+  //============================================================================
+  /**
+   * @brief Allocates the storage, preferring the mirrored mapping.
+   *
+   * @param _numChannels The number of channels.
+   * @param _minNumSamples The minimum number of samples per channel.
+   */
+  inline void allocate(const int _numChannels,
+                       const int _minNumSamples) noexcept
+  {
+    numChannels = std::max(_numChannels, 0);
+    numSamples = juce::nextPowerOfTwo(std::max(_minNumSamples, 1));
+#if defined(CMAKE_OS_IS_LINUX) && CMAKE_OS_IS_LINUX
+    const int pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+    const int samplesPerPage = pageSize / static_cast<int>(sizeof(SampleType));
+    if (juce::isPowerOfTwo(samplesPerPage))
+      numSamples = std::max(numSamples, samplesPerPage);
+#endif
+    mask = numSamples - 1;
+    channelStride = 2 * static_cast<size_t>(numSamples);
+
+    if (numChannels == 0) [[unlikely]]
+      return;
+
+    mirrored = allocateMirrored();
+    if (mirrored) [[likely]]
+      return;
+
+    fallback.calloc(static_cast<size_t>(numChannels) * channelStride);
+    data = fallback.get();
+  }
+
+  //============================================================================
+  /**
+   * @brief Maps every channel twice in a row onto the same memory.
+   *
+   * @return True on success, false if the fallback has to be used.
+   */
+  inline bool allocateMirrored() noexcept
+  {
+#if defined(CMAKE_OS_IS_LINUX) && CMAKE_OS_IS_LINUX
+    const size_t channelBytes =
+      static_cast<size_t>(numSamples) * sizeof(SampleType);
+    const size_t fileBytes = channelBytes * static_cast<size_t>(numChannels);
+    if (channelBytes % static_cast<size_t>(sysconf(_SC_PAGESIZE)) != 0)
+      return false;
+
+    const int file = memfd_create("dmt-mirrored-buffer", MFD_CLOEXEC);
+    if (file < 0)
+      return false;
+    if (ftruncate(file, static_cast<off_t>(fileBytes)) != 0) {
+      close(file);
+      return false;
+    }
+
+    // Reserve the address space first, then map the pages over it
+    void* reserved = mmap(nullptr,
+                          2 * fileBytes,
+                          PROT_NONE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                          -1,
+                          0);
+    if (reserved == MAP_FAILED) {
+      close(file);
+      return false;
+    }
+
+    auto* base = static_cast<char*>(reserved);
+    for (int channel = 0; channel < numChannels; ++channel) {
+      const size_t offset = static_cast<size_t>(channel) * channelBytes;
+      for (size_t half = 0; half < 2; ++half) {
+        void* address = base + 2 * offset + half * channelBytes;
+        void* mapped = mmap(address,
+                            channelBytes,
+                            PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED,
+                            file,
+                            static_cast<off_t>(offset));
+        if (mapped != address) [[unlikely]] {
+          munmap(reserved, 2 * fileBytes);
+          close(file);
+          return false;
+        }
+      }
+    }
+
+    // The mappings keep the memory alive
+    close(file);
+    mappedBytes = 2 * fileBytes;
+    data = static_cast<SampleType*>(reserved);
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //============================================================================
+  /**
+   * @brief Releases the storage.
+   */
+  inline void release() noexcept
+  {
+#if defined(CMAKE_OS_IS_LINUX) && CMAKE_OS_IS_LINUX
+    if (mirrored)
+      munmap(data, mappedBytes);
+#endif
+    fallback.free();
+    data = nullptr;
+    mirrored = false;
+    mappedBytes = 0;
+  }
+
+  //============================================================================
+  SampleType* data = nullptr;
+  juce::HeapBlock<SampleType> fallback;
+  size_t channelStride = 0;
+  size_t mappedBytes = 0;
+  int numChannels = 0;
+  int numSamples = 0;
+  int mask = 0;
+  bool mirrored = false;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MirroredAudioBuffer)
+};
+
+} // namespace data
+} // namespace dsp
+} // namespace dmt
@@ -30,8 +30,12 @@
 
 //==============================================================================
 
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/MinMaxPyramid.h"
+#include "dsp/data/MirroredAudioBuffer.h"
 #include "dsp/data/RingBufferInterface.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -46,11 +50,23 @@ namespace data {
  * reading.
  *
  * @tparam SampleType The type of audio sample (e.g., float, double).
+ *
+ * @details
+ * The samples are stored in a MirroredAudioBuffer, so the whole history from
+ * the oldest to the newest sample is always one contiguous range and the
+ * number of samples is rounded up to a power of two. Positions are derived
+ * from 64-bit cursors by masking, and detecting an overrun reader costs one
+ * subtraction per channel regardless of how many samples were written.
+ *
+ * Optionally, a MinMaxPyramid is kept up to date with every write. It holds a
+ * much longer history than the ring itself, at reduced resolution.
  */
 template<typename SampleType>
 class alignas(64) RingAudioBuffer : public RingBufferInterface<SampleType>
 {
   using AudioBuffer = juce::AudioBuffer<SampleType>;
+  using MirroredAudioBuffer = dmt::dsp::data::MirroredAudioBuffer<SampleType>;
+  using MinMaxPyramid = dmt::dsp::data::MinMaxPyramid<SampleType>;
   using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<SampleType>;
   using RingBufferInterface = dmt::dsp::data::RingBufferInterface<SampleType>;
 
@@ -61,15 +77,22 @@ public:
    * and samples.
    *
    * @param _numChannelsToAllocate The number of channels to allocate.
-   * @param _numSamplesToAllocate The number of samples to allocate.
+   * @param _numSamplesToAllocate The minimum number of samples to allocate.
+   * @param _numPyramidSamples The number of samples the min/max pyramid
+   * covers, or 0 to not keep a pyramid.
    */
-  constexpr RingAudioBuffer(const int _numChannelsToAllocate,
-                            const int _numSamplesToAllocate) noexcept
-    : RingBufferInterface(ringBuffer, writePosition, readPositions)
-    , writePosition(0)
+  RingAudioBuffer(const int _numChannelsToAllocate,
+                  const int _numSamplesToAllocate,
+                  const int _numPyramidSamples = 0) noexcept
+    : RingBufferInterface(ringBuffer, writeCursor, readCursors)
     , ringBuffer(_numChannelsToAllocate, _numSamplesToAllocate)
-    , readPositions(static_cast<size_t>(_numChannelsToAllocate), 0)
+    , scratch(_numChannelsToAllocate, ringBuffer.getNumSamples())
+    , writeCursor(0)
+    , readCursors(static_cast<size_t>(_numChannelsToAllocate), 0)
   {
+    if (_numPyramidSamples > 0)
+      pyramid = std::make_unique<MinMaxPyramid>(_numChannelsToAllocate,
+                                                _numPyramidSamples);
   }
 
   //============================================================================
@@ -91,26 +114,12 @@ public:
       return;
     }
 
-    const int firstBlockSize = getNumSamples() - writePosition;
-    const int secondBlockSize = samplesToWrite - firstBlockSize;
-
-    for (size_t channel = 0; channel < static_cast<size_t>(channelsToWrite);
-         ++channel) {
-      if (firstBlockSize > 0)
-        ringBuffer.copyFrom(static_cast<int>(channel),
-                            writePosition,
-                            _bufferToWrite,
-                            static_cast<int>(channel),
-                            0,
-                            firstBlockSize);
-      if (secondBlockSize > 0)
-        ringBuffer.copyFrom(static_cast<int>(channel),
-                            0,
-                            _bufferToWrite,
-                            static_cast<int>(channel),
-                            firstBlockSize,
-                            secondBlockSize);
-    }
+    const int writePosition = getWritePosition();
+    for (int channel = 0; channel < channelsToWrite; ++channel)
+      ringBuffer.write(channel,
+                       writePosition,
+                       _bufferToWrite.getReadPointer(channel),
+                       samplesToWrite);
 
     updateWritePosition(samplesToWrite);
   }
@@ -138,75 +147,90 @@ public:
     int start1, size1, start2, size2;
     _bufferToWrite.prepareToRead(samplesToWrite, start1, size1, start2, size2);
 
-    // Block 1 Section 1
-    if (size1 > 0) {
-      int section1size = jmin(size1, bufferSize - writePosition);
-      for (size_t channel = 0; channel < static_cast<size_t>(channelsToWrite);
-           ++channel) {
-        ringBuffer.copyFrom(static_cast<int>(channel),
-                            writePosition,
-                            source,
-                            static_cast<int>(channel),
-                            start1,
-                            section1size);
-      }
-      // Block 1 Section 2
-      int section2size = size1 - section1size;
-      if (section2size > 0) {
-        for (size_t channel = 0; channel < static_cast<size_t>(channelsToWrite);
-             ++channel) {
-          ringBuffer.copyFrom(static_cast<int>(channel),
-                              0,
-                              source,
-                              static_cast<int>(channel),
-                              start1 + section1size,
-                              section2size);
-        }
-      }
-    }
-    // Block 2 Section 3
-    if (size2 > 0) {
-      int block2start = (writePosition + size1) % bufferSize;
-      int section3size = jmin(size2, bufferSize - block2start);
-      for (size_t channel = 0; channel < static_cast<size_t>(channelsToWrite);
-           ++channel) {
-        ringBuffer.copyFrom(static_cast<int>(channel),
-                            block2start,
-                            source,
-                            static_cast<int>(channel),
-                            start2,
-                            section3size);
-      }
-      // Block 2 Section 4
-      int section4size = size2 - section3size;
-      if (section4size > 0) {
-        for (size_t channel = 0; channel < static_cast<size_t>(channelsToWrite);
-             ++channel) {
-          ringBuffer.copyFrom(static_cast<int>(channel),
-                              0,
-                              source,
-                              static_cast<int>(channel),
-                              start2 + section3size,
-                              section4size);
-        }
-      }
+    const int writePosition = getWritePosition();
+    for (int channel = 0; channel < channelsToWrite; ++channel) {
+      const SampleType* data = source.getReadPointer(channel);
+      ringBuffer.write(channel, writePosition, data + start1, size1);
+      ringBuffer.write(channel, writePosition + size1, data + start2, size2);
     }
 
     updateWritePosition(samplesToWrite);
     _bufferToWrite.finishedRead(size1 + size2);
   }
 
+  //============================================================================
+  /**
+   * @brief Writes everything a broadcast reader has pending to the ring buffer.
+   *
+   * @tparam BroadcastReader The reader type of a BroadcastAudioBuffer.
+   * @param _reader The reader to consume.
+   *
+   * @details
+   * The values are converted from the shared storage of the broadcast buffer
+   * into a scratch buffer first. Only if the reader confirms that the writer
+   * didn't overwrite them meanwhile, they are copied into the ring, so torn
+   * data never reaches the history. If there is more pending than fits, only
+   * the newest values are written.
+   *
+   * If the decimation of the broadcast stream changed, the ring buffer is
+   * cleared first, because old and new values have different time scales.
+   */
+  template<typename BroadcastReader>
+  forcedinline void write(BroadcastReader& _reader) noexcept
+  {
+    DSP_TRACER_COMPONENT("RingAudioBuffer::write");
+    using Source = typename BroadcastReader::Source;
+
+    const int channelsToWrite =
+      jmin(_reader.getNumChannels(), getNumChannels());
+    const auto view = _reader.acquire(getNumSamples());
+    if (view.decimation != decimation) [[unlikely]] {
+      clear();
+      decimation = view.decimation;
+    }
+    if (view.numSamples <= 0)
+      return;
+
+    for (int channel = 0; channel < channelsToWrite; ++channel) {
+      const auto span = _reader.getSpan(view, channel);
+      std::transform(span.begin(),
+                     span.end(),
+                     scratch.getWritePointer(channel),
+                     Source::toSample);
+    }
+    if (!_reader.release(view)) [[unlikely]]
+      return;
+
+    const int writePosition = getWritePosition();
+    for (int channel = 0; channel < channelsToWrite; ++channel)
+      ringBuffer.write(channel,
+                       writePosition,
+                       scratch.getReadPointer(channel),
+                       view.numSamples);
+
+    updateWritePosition(view.numSamples);
+  }
+
   //============================================================================
   /**
    * @brief Resizes the ring buffer.
    *
    * @param _numChannelsToAllocate The new number of channels.
-   * @param _numSamplesToAllocate The new buffer size.
+   * @param _numSamplesToAllocate The new minimum buffer size.
+   *
+   * @details
+   * Reallocates the storage, so all samples are cleared and the cursors are
+   * reset.
    */
-  forcedinline void resize(const int _numChannelsToAllocate,
-                           const int _numSamplesToAllocate) noexcept
+  inline void resize(const int _numChannelsToAllocate,
+                     const int _numSamplesToAllocate) noexcept
   {
     ringBuffer.setSize(_numChannelsToAllocate, _numSamplesToAllocate);
+    scratch.setSize(_numChannelsToAllocate, ringBuffer.getNumSamples());
+    readCursors.assign(static_cast<size_t>(_numChannelsToAllocate), 0);
+    writeCursor = 0;
+    if (pyramid != nullptr)
+      pyramid->reset();
   }
 
   //============================================================================
@@ -237,7 +261,19 @@ public:
    *
    * @return The write position.
    */
-  forcedinline int getWritePosition() const noexcept { return writePosition; }
+  forcedinline int getWritePosition() const noexcept
+  {
+    return static_cast<int>(writeCursor &
+                            static_cast<uint64_t>(getNumSamples() - 1));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the total number of samples written so far.
+   *
+   * @return The write cursor.
+   */
+  forcedinline uint64_t getWriteCursor() const noexcept { return writeCursor; }
 
   //============================================================================
   /**
@@ -246,7 +282,10 @@ public:
   forcedinline void clear() noexcept
   {
     ringBuffer.clear();
-    writePosition = 0;
+    writeCursor = 0;
+    std::fill(readCursors.begin(), readCursors.end(), 0);
+    if (pyramid != nullptr)
+      pyramid->reset();
   }
 
   //============================================================================
@@ -255,7 +294,27 @@ public:
    *
    * @return A reference to the audio buffer.
    */
-  forcedinline AudioBuffer& getBuffer() noexcept { return ringBuffer; }
+  forcedinline MirroredAudioBuffer& getBuffer() noexcept { return ringBuffer; }
+
+  //============================================================================
+  /**
+   * @brief Gets the decimation of the written samples.
+   *
+   * @return The number of input samples per min/max pair of the broadcast
+   * buffer the samples came from, or 1 if they aren't decimated.
+   */
+  forcedinline int getDecimation() const noexcept { return decimation; }
+
+  //============================================================================
+  /**
+   * @brief Gets the min/max pyramid of the written samples.
+   *
+   * @return The pyramid, or nullptr if the buffer doesn't keep one.
+   */
+  forcedinline const MinMaxPyramid* getPyramid() const noexcept
+  {
+    return pyramid.get();
+  }
 
 protected:
   //============================================================================
@@ -263,43 +322,33 @@ protected:
    * @brief Updates the write position in the ring buffer.
    *
    * @param _increment The amount to increment the write position.
+   *
+   * @details
+   * If a channel has more unread samples than the buffer holds, its oldest
+   * unread samples were overwritten. All read positions then jump to the write
+   * position, so readers start over with the next write.
    */
   forcedinline void updateWritePosition(const int _increment) noexcept
   {
-    bool moveWriteOverRead = false;
-    int newWritePosition = (writePosition + _increment) % getNumSamples();
-    if (writePosition == readPositions[0]) [[unlikely]] {
-      writePosition = newWritePosition;
-      return;
-    }
+    writeCursor += static_cast<uint64_t>(_increment);
+    if (pyramid != nullptr)
+      pyramid->update(ringBuffer, writeCursor);
 
-    // Check if the new write position overlaps with any read positions
-    for (size_t channel = 0; channel < static_cast<size_t>(getNumChannels());
-         ++channel) {
-      for (size_t i = 0; i < static_cast<size_t>(_increment); ++i) {
-        if ((writePosition + static_cast<int>(i)) % getNumSamples() ==
-            readPositions[channel]) [[unlikely]] {
-          moveWriteOverRead = true;
-          break;
-        }
-      }
-    }
-    // Update write position
-    writePosition = newWritePosition;
-
-    // Update read positions if necessary
-    if (moveWriteOverRead) {
-      for (size_t channel = 0; channel < static_cast<size_t>(getNumChannels());
-           ++channel) {
-        readPositions[channel] = writePosition;
-      }
+    const uint64_t lowestReadCursor =
+      *std::min_element(readCursors.begin(), readCursors.end());
+    if (writeCursor - lowestReadCursor > static_cast<uint64_t>(getNumSamples()))
+      [[unlikely]] {
+      std::fill(readCursors.begin(), readCursors.end(), writeCursor);
     }
   }
 
 private:
-  AudioBuffer ringBuffer;
-  int writePosition;
-  std::vector<int> readPositions;
+  MirroredAudioBuffer ringBuffer;
+  AudioBuffer scratch;
+  uint64_t writeCursor;
+  std::vector<uint64_t> readCursors;
+  std::unique_ptr<MinMaxPyramid> pyramid;
+  int decimation = 1;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RingAudioBuffer)
 };
@@ -30,7 +30,7 @@
 
 //==============================================================================
 
-#include "dsp/data/RingAudioBuffer.h"
+#include "dsp/data/MirroredAudioBuffer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -45,28 +45,34 @@ namespace data {
  * audio samples.
  *
  * @tparam SampleType The type of audio sample (e.g., float, double).
+ *
+ * @details
+ * Writing and reading is tracked with monotonically increasing 64-bit cursors
+ * that count samples since the buffer was created. They never wrap in practice
+ * and are only masked down to a position when the storage is accessed, so the
+ * distance between two cursors is always a single subtraction.
  */
 template<typename SampleType>
 class alignas(64) RingBufferInterface
 {
-  using AudioBuffer = juce::AudioBuffer<SampleType>;
+  using MirroredAudioBuffer = dmt::dsp::data::MirroredAudioBuffer<SampleType>;
 
 public:
   //============================================================================
   /**
    * @brief Constructs a RingBufferInterface with the given audio buffer and
-   * positions.
+   * cursors.
    *
    * @param _audioBuffer The audio buffer to use.
-   * @param _writePosition The write position in the buffer.
-   * @param _readPosition The read positions for each channel.
+   * @param _writeCursor The write cursor of the buffer.
+   * @param _readCursors The read cursors for each channel.
    */
-  constexpr RingBufferInterface(AudioBuffer& _audioBuffer,
-                                const int& _writePosition,
-                                std::vector<int>& _readPosition) noexcept
+  constexpr RingBufferInterface(MirroredAudioBuffer& _audioBuffer,
+                                const uint64_t& _writeCursor,
+                                std::vector<uint64_t>& _readCursors) noexcept
     : audioBuffer(_audioBuffer)
-    , writePosition(_writePosition)
-    , readPosition(_readPosition)
+    , writeCursor(_writeCursor)
+    , readCursors(_readCursors)
   {
   }
 
@@ -75,18 +81,32 @@ public:
    * @brief Retrieves a sample from the buffer.
    *
    * @param _channel The channel to read from.
-   * @param _sample The sample index to read.
+   * @param _sample The sample index to read, where 0 is the oldest sample.
    * @return The sample value.
    */
   forcedinline SampleType getSample(const int _channel,
                                     const int _sample) const noexcept
   {
-    const int numSamples = audioBuffer.getNumSamples();
-    const int block1size = numSamples - writePosition;
-    if (_sample < block1size) [[likely]] {
-      return audioBuffer.getSample(_channel, writePosition + _sample);
-    }
-    return audioBuffer.getSample(_channel, _sample - block1size);
+    return getReadPointer(_channel)[_sample];
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets a pointer to the samples of a channel.
+   *
+   * @param _channel The channel to read from.
+   * @param _sample The sample index of the first sample, where 0 is the oldest
+   * sample in the buffer.
+   * @return A pointer to the sample. The samples behind it are contiguous up to
+   * the newest sample, so it can be read without any wrap-around logic.
+   */
+  forcedinline const SampleType* getReadPointer(
+    const int _channel,
+    const int _sample = 0) const noexcept
+  {
+    const int oldestPosition = static_cast<int>(
+      writeCursor & static_cast<uint64_t>(audioBuffer.getNumSamples() - 1));
+    return audioBuffer.getReadPointer(_channel, oldestPosition + _sample);
   }
 
   //============================================================================
@@ -94,16 +114,15 @@ public:
    * @brief Gets the read position for a specific channel.
    *
    * @param _channel The channel index.
-   * @return The read position.
+   * @return The read position as a sample index, where 0 is the oldest sample.
+   * Equals the buffer size if there is nothing left to read.
    */
   forcedinline int getReadPosition(int _channel) const noexcept
   {
-    const int numSamples = audioBuffer.getNumSamples();
-    const int rawReadPosition = readPosition[_channel];
-    if (rawReadPosition > writePosition) [[likely]] {
-      return rawReadPosition - writePosition;
-    }
-    return numSamples - writePosition + rawReadPosition;
+    const uint64_t numSamples =
+      static_cast<uint64_t>(audioBuffer.getNumSamples());
+    const uint64_t unread = std::min(getNumUnread(_channel), numSamples);
+    return static_cast<int>(numSamples - unread);
   }
 
   //============================================================================
@@ -115,70 +134,66 @@ public:
    */
   forcedinline void incrementReadPosition(int _channel, int _increment) noexcept
   {
-    const int numSamples = audioBuffer.getNumSamples();
-    const int oldReadPosition = readPosition[_channel];
-    const int newReadPosition = (oldReadPosition + _increment) % numSamples;
-    readPosition[_channel] = newReadPosition;
+    readCursors[static_cast<size_t>(_channel)] +=
+      static_cast<uint64_t>(_increment);
   }
 
   //============================================================================
   /**
-   * @brief Sets the raw read position for a specific channel.
+   * @brief Gets the number of samples a channel hasn't read yet.
    *
    * @param _channel The channel index.
-   * @param _position The new read position.
+   * @return The distance between the read cursor and the write cursor. Values
+   * above the buffer size mean the reader was overrun.
    */
-  forcedinline void setRawReadPosition(const int _channel,
-                                       const int _position) noexcept
+  forcedinline uint64_t getNumUnread(const int _channel) const noexcept
   {
-    readPosition[_channel] = _position;
+    return writeCursor - readCursors[static_cast<size_t>(_channel)];
   }
 
   //============================================================================
   /**
-   * @brief Gets the raw read position for a specific channel.
+   * @brief Sets the read cursor for a specific channel.
    *
    * @param _channel The channel index.
-   * @return The raw read position.
+   * @param _cursor The new read cursor.
    */
-  forcedinline int getRawReadPosition(const int _channel) const noexcept
+  forcedinline void setReadCursor(const int _channel,
+                                  const uint64_t _cursor) noexcept
   {
-    return readPosition[_channel];
+    readCursors[static_cast<size_t>(_channel)] = _cursor;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the read cursor for a specific channel.
+   *
+   * @param _channel The channel index.
+   * @return The read cursor.
+   */
+  forcedinline uint64_t getReadCursor(const int _channel) const noexcept
+  {
+    return readCursors[static_cast<size_t>(_channel)];
   }
 
   //============================================================================
   /**
    * @brief Equalizes the read positions across all channels.
+   *
+   * @details
+   * All channels are moved to the channel that has read the furthest.
    */
   forcedinline void equalizeReadPositions() noexcept
   {
-    int highestReadPosition = 0;
-    int highestReadChannel = 0;
-
-    // Find the highest read position among all channels
-    for (size_t channel = 0; channel < audioBuffer.getNumChannels();
-         ++channel) {
-      const int readPos = getReadPosition(static_cast<int>(channel));
-      if (readPos > highestReadPosition) [[likely]] {
-        highestReadPosition = readPos;
-        highestReadChannel = static_cast<int>(channel);
-      }
-    }
-
-    // Get the raw read position for the channel with the highest read position
-    const int highestRawReadPosition = getRawReadPosition(highestReadChannel);
-
-    // Set all channels to the highest raw read position found
-    for (size_t channel = 0; channel < audioBuffer.getNumChannels();
-         ++channel) {
-      setRawReadPosition(static_cast<int>(channel), highestRawReadPosition);
-    }
+    const uint64_t highestReadCursor =
+      *std::max_element(readCursors.begin(), readCursors.end());
+    std::fill(readCursors.begin(), readCursors.end(), highestReadCursor);
   }
 
 private:
-  AudioBuffer& audioBuffer;
-  const int& writePosition;
-  std::vector<int>& readPosition;
+  MirroredAudioBuffer& audioBuffer;
+  const uint64_t& writeCursor;
+  std::vector<uint64_t>& readCursors;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RingBufferInterface)
 };
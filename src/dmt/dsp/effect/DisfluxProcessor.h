@@ -31,7 +31,9 @@
 //==============================================================================
 
 #include <JuceHeader.h>
+#include <utility/Logger.h>
 #include <utility/Settings.h>
+#include <utility/Tracer.h>
 
 //==============================================================================
 
@@ -68,6 +70,7 @@ class alignas(64) DisfluxProcessor
   using AudioBuffer = juce::AudioBuffer<float>;
   using Filter = juce::IIRFilter;
   using FilterArray = std::array<Filter, FILTER_AMOUNT>;
+  using Logger = dmt::utility::Logger;
 
 public:
   //==============================================================================
@@ -137,6 +140,8 @@ public:
 
     // Track last used frequency for output highpass
     lastHighpassFrequency = -1.0f;
+
+    Logger::log("Disflux prepared at {} Hz", sampleRate);
   }
 
   //==============================================================================
@@ -147,6 +152,7 @@ public:
    */
   inline void processBlock(AudioBuffer& _buffer) noexcept
   {
+    DSP_TRACER_BLOCK("DisfluxProcessor::processBlock");
     if (sampleRate <= 0.0f) {
       return;
     }
@@ -199,6 +205,7 @@ public:
         static_cast<int>(sampleRate * frequencySmoothTime));
       smoothedSpread.skip(static_cast<int>(sampleRate * spreadSmoothTime));
       smoothedPinch.skip(static_cast<int>(sampleRate * pinchSmoothTime));
+      Logger::log("Disflux filters reset for {} stages", amount);
     }
 
     // Output highpass filter: recalc coeffs only if freq changed and enabled
@@ -210,6 +217,8 @@ public:
       outputHighpassLeft.setCoefficients(highpassCoeffs);
       outputHighpassRight.setCoefficients(highpassCoeffs);
       lastHighpassFrequency = outputHighpassFrequency;
+      Logger::log("Disflux output highpass redesigned at {} Hz",
+                  outputHighpassFrequency);
     }
 
     int numSamples = _buffer.getNumSamples();
@@ -270,6 +279,7 @@ protected:
    */
   inline void setCoefficients(float freq, float sprd, float pnch) noexcept
   {
+    DSP_TRACER_SAMPLE("DisfluxProcessor::setCoefficients");
     const float spreadAmount = sprd;
     const float rangeStartFrequency =
       juce::jlimit(MIN_FREQUENCY, MAX_FREQUENCY, freq - (spreadAmount / 2.0f));
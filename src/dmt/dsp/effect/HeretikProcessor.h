@@ -31,6 +31,7 @@
 
 //==============================================================================
 
+#include "dsp/filter/SvfFilter.h"
 #include <JuceHeader.h>
 #include <utility/Settings.h>
 
@@ -51,12 +52,17 @@ class alignas(64) HeretikProcessor
 {
   using AudioBuffer = juce::AudioBuffer<float>;
   using DelayLine = juce::dsp::DelayLine<float>;
-  using Filter = juce::IIRFilter;
+  using Filter = dmt::dsp::filter::SvfFilter<2>;
+  using Frame = Filter::Frame;
 
   // Add constexprs for min and max delay times (in ms)
   static constexpr float maxDelayMs = 240.0f;
   static constexpr float minDelayMs = 1.0f;
 
+  // The tone filter ramps to new cutoffs over this time (in seconds)
+  static constexpr double toneSmoothTime = 0.02;
+  static constexpr float toneResonance = 0.5f;
+
 public:
   //==============================================================================
   /**
@@ -67,6 +73,7 @@ public:
   HeretikProcessor(juce::AudioProcessorValueTreeState& _apvts) noexcept
     : apvts(_apvts)
   {
+    toneFilter.setResonance(toneResonance);
   }
 
   //==============================================================================
@@ -85,6 +92,8 @@ public:
     spec.numChannels = 2;
     delayLine.prepare(spec);
     delayLine.setMaximumDelayInSamples((int)sampleRate);
+    toneFilter.prepare(_newSampleRate, toneSmoothTime);
+    feedbackBuffer.fill(0.0f);
   }
 
   //==============================================================================
@@ -106,39 +115,52 @@ public:
       apvts.getRawParameterValue("HeretikFeedback")->load();
     const float mix = apvts.getRawParameterValue("HeretikMix")->load();
 
-    // Applay the delay line to the input buffer
-    for (int channel = 0; channel < _buffer.getNumChannels(); ++channel) {
-      Filter& filter = channel == 0 ? leftFilter : rightFilter;
-      filter.setCoefficients(
-        juce::IIRCoefficients::makeLowPass(sampleRate, tone, 0.5f));
-      auto* channelData = _buffer.getWritePointer(channel);
-      for (int sample = 0; sample < _buffer.getNumSamples(); ++sample) {
-        // Dry signal
-        const float drySample = channelData[sample] + feedbackBuffer[channel];
-        delayLine.pushSample(channel, drySample);
-
-        // Set delay time
+    // Only starts a coefficient ramp if the tone actually changed
+    toneFilter.setCutoffFrequency(tone);
+
+    constexpr int maxChannels = static_cast<int>(std::tuple_size_v<Frame>);
+    const int numChannels = std::min(_buffer.getNumChannels(), maxChannels);
+    auto* const* channelData = _buffer.getArrayOfWritePointers();
+
+    // Both channels are processed per sample so the tone filter and the
+    // feedback path run over a whole frame at once
+    for (int sample = 0; sample < _buffer.getNumSamples(); ++sample) {
+      // Dry signal
+      Frame drySamples{};
+      for (int channel = 0; channel < numChannels; ++channel) {
+        drySamples[channel] =
+          channelData[channel][sample] + feedbackBuffer[channel];
+      }
+
+      // Filter the dry signal that modulates the delay time
+      Frame filteredSamples = drySamples;
+      toneFilter.processFrame(filteredSamples);
+
+      Frame wetSamples{};
+      for (int channel = 0; channel < numChannels; ++channel) {
+        delayLine.pushSample(channel, drySamples[channel]);
         const int delayInSamples =
-          getDelayInSamples(drySample, drive, range, filter);
-        delayLine.setDelay(delayInSamples);
-
-        // Output
-        const float wetSample = delayLine.popSample(channel);
-        const float mixSample = (wetSample * mix) + (drySample * (1.0f - mix));
-        channelData[sample] = mixSample;
-        feedbackBuffer[channel] = wetSample * feedback;
+          getDelayInSamples(filteredSamples[channel], drive, range);
+        wetSamples[channel] =
+          delayLine.popSample(channel, static_cast<float>(delayInSamples));
+      }
+
+      // Output
+      for (int channel = 0; channel < numChannels; ++channel) {
+        const float mixSample = (wetSamples[channel] * mix) +
+                                (drySamples[channel] * (1.0f - mix));
+        channelData[channel][sample] = mixSample;
+        feedbackBuffer[channel] = wetSamples[channel] * feedback;
       }
     }
   }
 
 protected:
-  int getDelayInSamples(const float _drySample,
+  int getDelayInSamples(const float _filteredSample,
                         const float _drive,
-                        const float _range,
-                        Filter& _filter) const noexcept
+                        const float _range) const noexcept
   {
-    const float filteredSample = _filter.processSingleSampleRaw(_drySample);
-    const float driveSample = filteredSample * _drive;
+    const float driveSample = _filteredSample * _drive;
     const float clampedSample = std::clamp(driveSample, -1.0f, 1.0f);
     const float denormalizedSample = (clampedSample + 1.0f) * 0.5f;
     const float multipliedSample = denormalizedSample * _range;
@@ -157,9 +179,8 @@ private:
   juce::AudioProcessorValueTreeState& apvts;
   DelayLine delayLine;
   float sampleRate = -1.0f;
-  std::array<float, 2> feedbackBuffer;
-  Filter leftFilter;
-  Filter rightFilter;
+  alignas(16) Frame feedbackBuffer{};
+  Filter toneFilter;
 };
 
 //==============================================================================
@@ -27,4 +27,8 @@
 
 #pragma once
 
+//==============================================================================
+
+#include "./SvfFilter.h"
+
 //==============================================================================
\ No newline at end of file
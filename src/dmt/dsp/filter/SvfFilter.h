@@ -0,0 +1,198 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * This file defines the SvfFilter class, a multi-channel lowpass filter based
+ * on the topology-preserving transform (TPT) state-variable structure. It
+ * smooths its cutoff frequency and only redesigns coefficients on change.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace filter {
+
+//==============================================================================
+/**
+ * @brief Multi-channel TPT state-variable lowpass filter.
+ *
+ * @tparam NumChannels The number of channels processed per frame.
+ *
+ * @details
+ * All channels share one set of coefficients and are processed together as a
+ * frame. The per-channel state lives in contiguous arrays, so the inner
+ * channel loop has no dependencies between iterations and can be vectorized
+ * by the compiler.
+ *
+ * Unlike juce::IIRFilter, the TPT structure stays stable and artifact-free
+ * while the cutoff is being modulated. The cutoff is smoothed internally and
+ * the coefficients are only recalculated while the smoother is ramping, so a
+ * static cutoff costs nothing beyond the filter itself.
+ */
+template<size_t NumChannels>
+class alignas(64) SvfFilter
+{
+  using SmoothedValue =
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative>;
+
+  constexpr static float MIN_FREQUENCY = 20.0f;
+  constexpr static float MAX_FREQUENCY = 20000.0f;
+
+public:
+  using Frame = std::array<float, NumChannels>;
+
+  //==============================================================================
+  /**
+   * @brief Prepares the filter for the given sample rate.
+   *
+   * @param _sampleRate The sample rate.
+   * @param _smoothingTime The ramp length of cutoff changes in seconds.
+   */
+  inline void prepare(const double _sampleRate,
+                      const double _smoothingTime) noexcept
+  {
+    sampleRate = static_cast<float>(_sampleRate);
+    cutoff.reset(_sampleRate, _smoothingTime);
+    cutoff.setCurrentAndTargetValue(cutoff.getTargetValue());
+    updateCoefficients(cutoff.getCurrentValue());
+    reset();
+  }
+
+  //==============================================================================
+  /**
+   * @brief Clears the filter state of all channels.
+   */
+  inline void reset() noexcept
+  {
+    firstIntegrator.fill(0.0f);
+    secondIntegrator.fill(0.0f);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the target cutoff frequency.
+   *
+   * @param _frequency The new cutoff frequency in Hz.
+   *
+   * @details
+   * Does nothing if the target didn't change. Otherwise the cutoff ramps
+   * towards the new target over the smoothing time given to prepare().
+   */
+  inline void setCutoffFrequency(const float _frequency) noexcept
+  {
+    const float frequency =
+      std::clamp(_frequency, MIN_FREQUENCY, getMaxFrequency());
+    if (juce::approximatelyEqual(frequency, cutoff.getTargetValue()))
+      return;
+    cutoff.setTargetValue(frequency);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the resonance of the filter.
+   *
+   * @param _q The quality factor. 0.5 gives a critically damped response.
+   */
+  inline void setResonance(const float _q) noexcept
+  {
+    damping = 1.0f / std::max(_q, 0.01f);
+    updateCoefficients(cutoff.getCurrentValue());
+  }
+
+  //==============================================================================
+  /**
+   * @brief Filters one frame of samples in place.
+   *
+   * @param _frame One sample for every channel.
+   */
+  forcedinline void processFrame(Frame& _frame) noexcept
+  {
+    if (cutoff.isSmoothing()) [[unlikely]]
+      updateCoefficients(cutoff.getNextValue());
+
+    for (size_t channel = 0; channel < NumChannels; ++channel) {
+      const float v3 = _frame[channel] - secondIntegrator[channel];
+      const float v1 = a1 * firstIntegrator[channel] + a2 * v3;
+      const float v2 =
+        secondIntegrator[channel] + a2 * firstIntegrator[channel] + a3 * v3;
+      firstIntegrator[channel] = 2.0f * v1 - firstIntegrator[channel];
+      secondIntegrator[channel] = 2.0f * v2 - secondIntegrator[channel];
+      _frame[channel] = v2;
+    }
+  }
+
+protected:
+  //==============================================================================
+  /**
+   * @brief Recalculates the coefficients for the given cutoff.
+   *
+   * @param _frequency The cutoff frequency in Hz.
+   */
+  inline void updateCoefficients(const float _frequency) noexcept
+  {
+    if (sampleRate <= 0.0f) [[unlikely]]
+      return;
+
+    const float normalizedFrequency =
+      std::min(_frequency, getMaxFrequency()) / sampleRate;
+    const float g =
+      std::tan(juce::MathConstants<float>::pi * normalizedFrequency);
+    a1 = 1.0f / (1.0f + g * (g + damping));
+    a2 = g * a1;
+    a3 = g * a2;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the highest cutoff that is still stable at this sample rate.
+   */
+  [[nodiscard]] inline float getMaxFrequency() const noexcept
+  {
+    if (sampleRate <= 0.0f)
+      return MAX_FREQUENCY;
+    return std::min(MAX_FREQUENCY, sampleRate * 0.49f);
+  }
+
+private:
+  //==============================================================================
+  float sampleRate = -1.0f;
+  float damping = 2.0f;
+  float a1 = 1.0f;
+  float a2 = 0.0f;
+  float a3 = 0.0f;
+  SmoothedValue cutoff{ MAX_FREQUENCY };
+  alignas(16) Frame firstIntegrator{};
+  alignas(16) Frame secondIntegrator{};
+};
+
+//==============================================================================
+} // namespace filter
+} // namespace dsp
+} // namespace dmt
@@ -30,6 +30,9 @@
 //==============================================================================
 
 #include "AnalogWaveform.h"
+#include "AnalogWavetable.h"
+#include "AnalogWavetableBuilder.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -47,27 +50,86 @@ namespace synth {
  * This class is designed for maximum real-time performance, using aggressive
  * optimizations such as constexpr, inline, noexcept, and forceinline. It
  * generates analog waveforms with various modulation capabilities.
+ *
+ * By default every sample is computed directly from the waveform, which
+ * aliases at high frequencies. The optional wavetable backend instead reads
+ * from band-limited octave tables that are rendered from the same shape. The
+ * bend, PWM and sync modifiers are quantized to VARIANT_STEPS steps on that
+ * backend, and whenever the shape moves to a new variant the audio thread
+ * asks the shared AnalogWavetableBuilder for new tables. Until they are
+ * swapped in, the previous tables keep playing.
  */
-class alignas(64) AnalogOscillator
+class alignas(64) AnalogOscillator : private AnalogWavetableBuilder::Client
 {
   using Math = juce::dsp::FastMathApproximations;
+  using Builder = juce::SharedResourcePointer<AnalogWavetableBuilder>;
   static constexpr float twoPi = juce::MathConstants<float>::twoPi;
   static constexpr float pi = juce::MathConstants<float>::pi;
+  static constexpr float VARIANT_STEPS = 64.0f;
+  static constexpr int NUM_WAVETABLES = 3;
+  static constexpr int FRESH_WAVETABLE = 4;
 
 public:
+  //==============================================================================
+  inline AnalogOscillator() noexcept = default;
+
+  //==============================================================================
+  inline ~AnalogOscillator() noexcept override
+  {
+    if (builder != nullptr)
+      (*builder)->removeClient(*this);
+  }
+
+  //==============================================================================
+  enum class Backend
+  {
+    Direct,
+    Wavetable
+  };
+
+  //==============================================================================
+  /**
+   * @brief Selects how the waveform is generated.
+   * @param _newBackend The new backend.
+   *
+   * @details
+   * Switching to the wavetable backend allocates and renders the tables, so
+   * this must not be called from the audio thread.
+   */
+  inline void setBackend(const Backend _newBackend)
+  {
+    DSP_TRACER_COMPONENT("AnalogOscillator::setBackend");
+    backend = _newBackend;
+    if (backend != Backend::Wavetable || builder != nullptr)
+      return;
+
+    for (auto& wavetable : wavetables)
+      wavetable = std::make_unique<AnalogWavetable>();
+    builder = std::make_unique<Builder>();
+    if (sampleRate > 0.0f)
+      prepareWavetables();
+  }
+
   //==============================================================================
   /**
    * @brief Sets the sample rate for the oscillator.
    * @param _newSampleRate The new sample rate in Hz.
+   *
+   * @details
+   * With the wavetable backend, this renders the tables for the current shape
+   * and must not be called from the audio thread.
    */
   inline void setSampleRate(const float _newSampleRate) noexcept
   {
-    TRACER("AnalogOscillator::setSampleRate");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setSampleRate");
     float rangeEnd =
       std::nextafter(392000.0f, std::numeric_limits<float>::max());
     const juce::Range<float> validRange(20.0f, rangeEnd);
     jassert(validRange.contains(_newSampleRate));
     sampleRate = _newSampleRate;
+
+    if (builder != nullptr)
+      prepareWavetables();
   }
 
   //==============================================================================
@@ -77,23 +139,70 @@ public:
    */
   [[nodiscard]] forcedinline float getNextSample() noexcept
   {
-    TRACER("AnalogOscillator::getNextSample");
+    DSP_TRACER_SAMPLE("AnalogOscillator::getNextSample");
     if (sampleRate <= 0.0f)
       return 0.0f;
 
     advancePhase();
 
-    auto syncedPhase = getSyncedPhase(phase * pwmModifier);
-    auto bendedPhase = getBendedPhase(syncedPhase);
-
-    if (phase >= twoPi / pwmModifier)
-      return 0.0f;
-
-    float sample = waveform.getSample(bendedPhase);
+    float sample = 0.0f;
+    if (backend == Backend::Wavetable) {
+      sample = getWavetableSample();
+    } else {
+      if (phase >= twoPi / pwmModifier)
+        return 0.0f;
+      sample = getShapedSample(phase);
+    }
     distortSample(sample);
     return std::clamp(sample, -1.0f, +1.0f);
   }
 
+  //==============================================================================
+  /**
+   * @brief Renders a block of samples.
+   * @param _output The buffer to write the samples to.
+   * @param _frequencies The frequency in Hz for every sample of the block.
+   * @param _numSamples The number of samples to render.
+   *
+   * @details
+   * Produces the same samples as calling setFrequency() and getNextSample()
+   * for every sample, but the backend and waveform are dispatched once per
+   * block so the inner loop is free of calls and switches.
+   */
+  inline void renderBlock(float* _output,
+                          const float* _frequencies,
+                          const int _numSamples) noexcept
+  {
+    DSP_TRACER_COMPONENT("AnalogOscillator::renderBlock");
+    if (sampleRate <= 0.0f || _numSamples <= 0) {
+      std::fill_n(_output, std::max(_numSamples, 0), 0.0f);
+      return;
+    }
+
+    if (backend == Backend::Wavetable) {
+      renderWavetableBlock(_output, _frequencies, _numSamples);
+    } else {
+      using Type = AnalogWaveform::Type;
+      switch (waveform.type) {
+        case Type::Sine:
+          renderDirectBlock<Type::Sine>(_output, _frequencies, _numSamples);
+          break;
+        case Type::Saw:
+          renderDirectBlock<Type::Saw>(_output, _frequencies, _numSamples);
+          break;
+        case Type::Triangle:
+          renderDirectBlock<Type::Triangle>(
+            _output, _frequencies, _numSamples);
+          break;
+        case Type::Square:
+          renderDirectBlock<Type::Square>(_output, _frequencies, _numSamples);
+          break;
+      }
+    }
+
+    frequency = _frequencies[_numSamples - 1];
+  }
+
   //==============================================================================
   /**
    * @brief Sets the frequency of the oscillator.
@@ -101,7 +210,7 @@ public:
    */
   inline void setFrequency(const float _newFrequency) noexcept
   {
-    TRACER("AnalogOscillator::setFrequency");
+    DSP_TRACER_SAMPLE("AnalogOscillator::setFrequency");
     frequency = _newFrequency;
   }
 
@@ -113,8 +222,9 @@ public:
   inline void setWaveformType(
     const dmt::dsp::synth::AnalogWaveform::Type _type) noexcept
   {
-    TRACER("AnalogOscillator::setWaveformType");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setWaveformType");
     waveform.type = _type;
+    updateVariant();
   }
 
   //==============================================================================
@@ -124,7 +234,7 @@ public:
    */
   inline void setDrive(const float _newDrive) noexcept
   {
-    TRACER("AnalogOscillator::setDrive");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setDrive");
     drive = _newDrive;
   }
 
@@ -135,7 +245,7 @@ public:
    */
   inline void setBias(const float _newBias) noexcept
   {
-    TRACER("AnalogOscillator::setBias");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setBias");
     bias = _newBias;
   }
 
@@ -146,7 +256,7 @@ public:
    */
   inline void setPhase(const float _newPhase) noexcept
   {
-    TRACER("AnalogOscillator::setPhase");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setPhase");
     phase = _newPhase;
   }
 
@@ -157,13 +267,14 @@ public:
    */
   inline void setBend(const float _newBendModifier) noexcept
   {
-    TRACER("AnalogOscillator::setBend");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setBend");
     float rangeEnd = std::nextafter(100.0f, std::numeric_limits<float>::max());
     const juce::NormalisableRange<float> sourceRange(-100.0f, rangeEnd);
     jassert(sourceRange.getRange().contains(_newBendModifier));
     const auto normalisedValue = sourceRange.convertTo0to1(_newBendModifier);
     const juce::NormalisableRange<float> targetRange(0.1f, 0.9f);
     posityCycleRatio = targetRange.convertFrom0to1(normalisedValue);
+    updateVariant();
   }
 
   //==============================================================================
@@ -173,13 +284,14 @@ public:
    */
   inline void setPwm(const float _newPwmModifier) noexcept
   {
-    TRACER("AnalogOscillator::setPwm");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setPwm");
     float rangeEnd = std::nextafter(100.0f, std::numeric_limits<float>::max());
     const juce::NormalisableRange<float> sourceRange(0.0f, rangeEnd);
     jassert(sourceRange.getRange().contains(_newPwmModifier));
     const auto normalisedValue = sourceRange.convertTo0to1(_newPwmModifier);
     const juce::NormalisableRange<float> targetRange(1.0f, 5.0f);
     pwmModifier = targetRange.convertFrom0to1(normalisedValue);
+    updateVariant();
   }
 
   //==============================================================================
@@ -189,16 +301,45 @@ public:
    */
   inline void setSync(const float _newSyncModifier) noexcept
   {
-    TRACER("AnalogOscillator::setSync");
+    DSP_TRACER_COMPONENT("AnalogOscillator::setSync");
     float rangeEnd = std::nextafter(100.0f, std::numeric_limits<float>::max());
     const juce::NormalisableRange<float> sourceRange(0.0f, rangeEnd);
     jassert(sourceRange.getRange().contains(_newSyncModifier));
     const auto normalisedValue = sourceRange.convertTo0to1(_newSyncModifier);
     const juce::NormalisableRange<float> targetRange(1.0f, 5.0f);
     syncModifier = targetRange.convertFrom0to1(normalisedValue);
+    updateVariant();
   }
 
 private:
+  //==============================================================================
+  struct Variant
+  {
+    AnalogWaveform::Type type = AnalogWaveform::Type::Sine;
+    int bend = 0;
+    int pwm = 0;
+    int sync = 0;
+
+    bool operator==(const Variant&) const noexcept = default;
+
+    // Packs the variant into one word, so it can be handed over atomically
+    [[nodiscard]] inline uint32_t pack() const noexcept
+    {
+      return static_cast<uint32_t>(type) | static_cast<uint32_t>(bend) << 8 |
+             static_cast<uint32_t>(pwm) << 16 |
+             static_cast<uint32_t>(sync) << 24;
+    }
+
+    [[nodiscard]] inline static Variant unpack(const uint32_t _packed) noexcept
+    {
+      return { static_cast<AnalogWaveform::Type>(_packed & 0xff),
+               static_cast<int>((_packed >> 8) & 0xff),
+               static_cast<int>((_packed >> 16) & 0xff),
+               static_cast<int>(_packed >> 24) };
+    }
+  };
+
+  //==============================================================================
   dmt::dsp::synth::AnalogWaveform waveform;
   float frequency = 50.0f;
   float sampleRate = -1.0f;
@@ -210,13 +351,255 @@ private:
   float syncModifier = 1.0f;
   float posityCycleRatio = 0.5f;
 
+  Backend backend = Backend::Direct;
+  std::unique_ptr<Builder> builder;
+
+  // Triple buffer shared with the builder thread. The audio thread reads the
+  // front table and the builder renders into the back table. The middle index
+  // is exchanged between them and flagged with FRESH_WAVETABLE once the
+  // builder has put a new table there.
+  std::array<std::unique_ptr<AnalogWavetable>, NUM_WAVETABLES> wavetables;
+  int frontIndex = 0;
+  int backIndex = 2;
+  std::atomic<int> middleIndex{ 1 };
+  std::atomic<uint32_t> requestedVariant{ 0 };
+  uint32_t builtVariant = 0;
+
+  //==============================================================================
+  /**
+   * @brief Renders a block with the direct backend.
+   * @tparam WaveformType The current waveform type.
+   * @param _output The buffer to write the samples to.
+   * @param _frequencies The frequency in Hz for every sample of the block.
+   * @param _numSamples The number of samples to render.
+   */
+  template<AnalogWaveform::Type WaveformType>
+  inline void renderDirectBlock(float* _output,
+                                const float* _frequencies,
+                                const int _numSamples) noexcept
+  {
+    const float phaseScale = twoPi / sampleRate;
+    const float cycleEnd = twoPi / pwmModifier;
+
+    for (int i = 0; i < _numSamples; ++i) {
+      phase += _frequencies[i] * phaseScale;
+      if (phase >= twoPi)
+        phase -= twoPi;
+
+      if (phase >= cycleEnd) {
+        _output[i] = 0.0f;
+        continue;
+      }
+
+      const float syncedPhase = getSyncedPhase(phase * pwmModifier);
+      const float bendedPhase = getBendedPhase(syncedPhase);
+      float sample = waveform.getSample<WaveformType>(bendedPhase);
+      distortSample(sample);
+      _output[i] = std::clamp(sample, -1.0f, +1.0f);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders a block with the wavetable backend.
+   * @param _output The buffer to write the samples to.
+   * @param _frequencies The frequency in Hz for every sample of the block.
+   * @param _numSamples The number of samples to render.
+   *
+   * @details
+   * The tables already hold the whole PWM cycle including its silent tail, so
+   * they are read over the full phase. Cutting the tail here would bring back
+   * the naive step the tables are band-limiting.
+   */
+  inline void renderWavetableBlock(float* _output,
+                                   const float* _frequencies,
+                                   const int _numSamples) noexcept
+  {
+    const auto& wavetable = acquireWavetable();
+    const float phaseScale = twoPi / sampleRate;
+
+    for (int i = 0; i < _numSamples; ++i) {
+      phase += _frequencies[i] * phaseScale;
+      if (phase >= twoPi)
+        phase -= twoPi;
+
+      const int level = wavetable.getLevel(_frequencies[i]);
+      float sample = wavetable.getSample(phase * (1.0f / twoPi), level);
+      distortSample(sample);
+      _output[i] = std::clamp(sample, -1.0f, +1.0f);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Computes the naive waveform sample for a phase.
+   * @param _phase The phase in radians.
+   * @return The sample before distortion.
+   */
+  forcedinline float getShapedSample(const float _phase) const noexcept
+  {
+    auto syncedPhase = getSyncedPhase(_phase * pwmModifier);
+    auto bendedPhase = getBendedPhase(syncedPhase);
+    return waveform.getSample(bendedPhase);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Computes the naive waveform sample of a quantized shape.
+   * @param _phase The phase in radians.
+   * @param _variant The quantized shape.
+   * @return The sample before distortion.
+   *
+   * @details
+   * Only reads the variant, so it is safe to call from the builder thread.
+   */
+  [[nodiscard]] inline static float getVariantSample(
+    const float _phase,
+    const Variant& _variant) noexcept
+  {
+    const float steps = VARIANT_STEPS;
+    const float pwm = 1.0f + 4.0f * static_cast<float>(_variant.pwm) / steps;
+    if (_phase >= twoPi / pwm)
+      return 0.0f;
+
+    const float sync = 1.0f + 4.0f * static_cast<float>(_variant.sync) / steps;
+    const float ratio = 0.1f + 0.8f * static_cast<float>(_variant.bend) / steps;
+    const auto syncedPhase = getSyncedPhase(_phase * pwm, sync);
+    const auto bendedPhase = getBendedPhase(syncedPhase, ratio);
+    return AnalogWaveform{ _variant.type }.getSample(bendedPhase);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Reads the current phase from the band-limited tables.
+   * @return The sample before distortion.
+   */
+  forcedinline float getWavetableSample() noexcept
+  {
+    const auto& wavetable = acquireWavetable();
+    const int level = wavetable.getLevel(frequency);
+    return wavetable.getSample(phase * (1.0f / twoPi), level);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Swaps in the newest table published by the builder.
+   * @return The table to read from on the audio thread.
+   */
+  [[nodiscard]] forcedinline const AnalogWavetable& acquireWavetable() noexcept
+  {
+    const int middle = middleIndex.load(std::memory_order_relaxed);
+    if (middle & FRESH_WAVETABLE) [[unlikely]] {
+      const int index =
+        middleIndex.exchange(frontIndex, std::memory_order_acq_rel);
+      frontIndex = index & ~FRESH_WAVETABLE;
+    }
+    return *wavetables[frontIndex];
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the quantized variant of the current shape parameters.
+   */
+  [[nodiscard]] inline Variant getVariant() const noexcept
+  {
+    const auto quantize = [](const float _normalised) {
+      return juce::roundToInt(_normalised * VARIANT_STEPS);
+    };
+    return { waveform.type,
+             quantize((posityCycleRatio - 0.1f) / 0.8f),
+             quantize((pwmModifier - 1.0f) / 4.0f),
+             quantize((syncModifier - 1.0f) / 4.0f) };
+  }
+
+  //==============================================================================
+  /**
+   * @brief Asks the builder for the tables of the current variant.
+   *
+   * @details
+   * Only stores an atomic and signals the builder when the variant changed,
+   * so it is safe to call from the audio thread. Parameter updates that keep
+   * the variant don't touch the builder at all.
+   */
+  inline void updateVariant() noexcept
+  {
+    if (builder == nullptr)
+      return;
+
+    const auto variant = getVariant().pack();
+    if (requestedVariant.exchange(variant, std::memory_order_relaxed) !=
+        variant)
+      (*builder)->notify();
+  }
+
+  //==============================================================================
+  /**
+   * @brief Prepares all tables and renders the current variant into the front.
+   *
+   * @details
+   * The builder is detached meanwhile, so it can't race with the preparation.
+   */
+  inline void prepareWavetables()
+  {
+    DSP_TRACER_COMPONENT("AnalogOscillator::prepareWavetables");
+    (*builder)->removeClient(*this);
+
+    for (auto& wavetable : wavetables)
+      wavetable->prepare(sampleRate);
+
+    frontIndex = 0;
+    middleIndex.store(1, std::memory_order_relaxed);
+    backIndex = 2;
+
+    builtVariant = getVariant().pack();
+    requestedVariant.store(builtVariant, std::memory_order_relaxed);
+    renderVariant(*wavetables[frontIndex], Variant::unpack(builtVariant));
+
+    (*builder)->addClient(*this);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders the requested variant and publishes it to the audio thread.
+   *
+   * @details
+   * Called on the builder thread.
+   */
+  inline void buildWavetable() noexcept override
+  {
+    const auto variant = requestedVariant.load(std::memory_order_relaxed);
+    if (variant == builtVariant)
+      return;
+
+    DSP_TRACER_COMPONENT("AnalogOscillator::buildWavetable");
+    renderVariant(*wavetables[backIndex], Variant::unpack(variant));
+    builtVariant = variant;
+
+    const int index = middleIndex.exchange(backIndex | FRESH_WAVETABLE,
+                                           std::memory_order_acq_rel);
+    backIndex = index & ~FRESH_WAVETABLE;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders the band-limited tables of a variant.
+   * @param _wavetable The tables to render into.
+   * @param _variant The quantized shape.
+   */
+  inline static void renderVariant(AnalogWavetable& _wavetable,
+                                   const Variant& _variant) noexcept
+  {
+    _wavetable.render([&_variant](const float _phase) {
+      return getVariantSample(_phase, _variant);
+    });
+  }
+
   //==============================================================================
   /**
    * @brief Advances the phase of the oscillator.
    */
   forcedinline void advancePhase() noexcept
   {
-    TRACER("AnalogOscillator::advancePhase");
     float cycleLength = sampleRate / frequency;
     float phaseDelta = twoPi / cycleLength;
     phase += phaseDelta;
@@ -234,8 +617,20 @@ private:
    */
   forcedinline float getSyncedPhase(float _rawPhase) const noexcept
   {
-    TRACER("AnalogOscillator::getSyncedPhase");
-    float syncedPhase = _rawPhase * syncModifier;
+    return getSyncedPhase(_rawPhase, syncModifier);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Computes the synced phase for an explicit sync modifier.
+   * @param _rawPhase The raw phase value.
+   * @param _syncModifier The sync modifier.
+   * @return The synced phase value.
+   */
+  forcedinline static float getSyncedPhase(float _rawPhase,
+                                           float _syncModifier) noexcept
+  {
+    float syncedPhase = _rawPhase * _syncModifier;
     while (syncedPhase >= twoPi) {
       syncedPhase -= twoPi;
     }
@@ -250,15 +645,27 @@ private:
    */
   forcedinline float getBendedPhase(float _rawPhase) const noexcept
   {
-    TRACER("AnalogOscillator::getBendedPhase");
+    return getBendedPhase(_rawPhase, posityCycleRatio);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Computes the bended phase for an explicit positive cycle ratio.
+   * @param _rawPhase The raw phase value.
+   * @param _posityCycleRatio The ratio of the positive half cycle.
+   * @return The bended phase value.
+   */
+  forcedinline static float getBendedPhase(float _rawPhase,
+                                           float _posityCycleRatio) noexcept
+  {
     auto bendedPhase = _rawPhase;
 
-    float positiveCycleSize = posityCycleRatio * twoPi;
-    float negativeCycleRatio = 1.0f - posityCycleRatio;
+    float positiveCycleSize = _posityCycleRatio * twoPi;
+    float negativeCycleRatio = 1.0f - _posityCycleRatio;
     float negativeCycleSize = negativeCycleRatio * twoPi;
 
     if (_rawPhase <= positiveCycleSize) {
-      bendedPhase /= (posityCycleRatio * 2.0f);
+      bendedPhase /= (_posityCycleRatio * 2.0f);
     }
 
     if (_rawPhase > positiveCycleSize) {
@@ -276,7 +683,6 @@ private:
    */
   forcedinline void distortSample(float& _sample) const noexcept
   {
-    TRACER("AnalogOscillator::distortSample");
     constexpr float magicNumber = 0.7615941559558f;
     if (drive >= 1.0f) {
       _sample = Math::tanh(drive * _sample);
@@ -141,6 +141,30 @@ struct AnalogWaveform
     }
   }
 
+  //==============================================================================
+  /**
+   * @brief Get the waveform sample for a waveform type known at compile time.
+   * @tparam WaveformType The waveform type to generate.
+   * @param _x The phase of the waveform.
+   * @return The waveform sample.
+   *
+   * @details
+   * Used by block rendering, where the type is dispatched once per block
+   * instead of once per sample.
+   */
+  template<Type WaveformType>
+  [[nodiscard]] forcedinline float getSample(float _x) const noexcept
+  {
+    if constexpr (WaveformType == Type::Sine)
+      return sine(_x);
+    else if constexpr (WaveformType == Type::Saw)
+      return saw(_x);
+    else if constexpr (WaveformType == Type::Triangle)
+      return triangle(_x);
+    else
+      return square(_x);
+  }
+
   //==============================================================================
 };
 
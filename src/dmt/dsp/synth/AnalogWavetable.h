@@ -0,0 +1,218 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Band-limited, octave-mipmapped single cycle tables for the analog
+ * oscillator. Each table is rendered from the naive oscillator shape and has
+ * every harmonic above the Nyquist frequency of its octave removed.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace synth {
+
+//==============================================================================
+
+/**
+ * @class AnalogWavetable
+ * @brief Octave-mipmapped band-limited wavetable.
+ *
+ * One table is kept per octave of fundamental frequency, starting at
+ * MIN_FREQUENCY. The table for an octave only contains the harmonics that stay
+ * below Nyquist at the top of that octave, so reading it at any frequency
+ * inside the octave does not alias.
+ *
+ * Tables are rendered by sampling one cycle of an arbitrary shape at a high
+ * resolution, transforming it once and resynthesizing every octave with an
+ * inverse FFT. All buffers are allocated in prepare(), so render() does not
+ * allocate, but it is still far too expensive to call for every sample.
+ */
+class alignas(64) AnalogWavetable
+{
+  static constexpr int TABLE_ORDER = 11;
+  static constexpr int TABLE_SIZE = 1 << TABLE_ORDER;
+  static constexpr int TABLE_STRIDE = TABLE_SIZE + 1;
+  static constexpr int RENDER_ORDER = TABLE_ORDER + 2;
+  static constexpr int RENDER_SIZE = 1 << RENDER_ORDER;
+  static constexpr int NUM_LEVELS = 11;
+  static constexpr float MIN_FREQUENCY = 20.0f;
+  static constexpr float twoPi = juce::MathConstants<float>::twoPi;
+
+public:
+  //==============================================================================
+  AnalogWavetable() noexcept
+    : renderFft(RENDER_ORDER)
+    , tableFft(TABLE_ORDER)
+  {
+  }
+
+  //==============================================================================
+  /**
+   * @brief Allocates the tables and sets the sample rate used for band-limiting.
+   * @param _sampleRate The sample rate in Hz.
+   */
+  inline void prepare(const float _sampleRate)
+  {
+    DSP_TRACER_COMPONENT("AnalogWavetable::prepare");
+    sampleRate = _sampleRate;
+    tables.assign(static_cast<size_t>(NUM_LEVELS * TABLE_STRIDE), 0.0f);
+    renderBuffer.assign(static_cast<size_t>(2 * RENDER_SIZE), 0.0f);
+    tableBuffer.assign(static_cast<size_t>(2 * TABLE_SIZE), 0.0f);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders all octave tables from the given cycle shape.
+   * @param _shape Callable returning the naive sample for a phase in radians.
+   */
+  template<typename Shape>
+  inline void render(Shape&& _shape) noexcept
+  {
+    DSP_TRACER_COMPONENT("AnalogWavetable::render");
+    if (!isPrepared()) [[unlikely]]
+      return;
+
+    std::fill(renderBuffer.begin(), renderBuffer.end(), 0.0f);
+    const float phaseDelta = twoPi / static_cast<float>(RENDER_SIZE);
+    for (int i = 0; i < RENDER_SIZE; ++i)
+      renderBuffer[i] = _shape(static_cast<float>(i) * phaseDelta);
+
+    renderFft.performRealOnlyForwardTransform(renderBuffer.data());
+
+    for (int level = 0; level < NUM_LEVELS; ++level)
+      renderLevel(level);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the table level to use for a fundamental frequency.
+   * @param _frequency The fundamental frequency in Hz.
+   * @return The index of the octave table.
+   */
+  [[nodiscard]] forcedinline int getLevel(const float _frequency) const noexcept
+  {
+    if (_frequency <= MIN_FREQUENCY)
+      return 0;
+    const int octave = std::ilogb(_frequency * (1.0f / MIN_FREQUENCY));
+    return std::min(octave, NUM_LEVELS - 1);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Reads a linearly interpolated sample from an octave table.
+   * @param _phase The normalized phase in the range [0, 1).
+   * @param _level The octave table as returned by getLevel().
+   * @return The interpolated sample.
+   */
+  [[nodiscard]] forcedinline float getSample(const float _phase,
+                                             const int _level) const noexcept
+  {
+    const float position = _phase * static_cast<float>(TABLE_SIZE);
+    const int index = static_cast<int>(position);
+    const float fraction = position - static_cast<float>(index);
+    const float* table = tables.data() + _level * TABLE_STRIDE;
+    const int wrapped = index & (TABLE_SIZE - 1);
+    const float current = table[wrapped];
+    return current + fraction * (table[wrapped + 1] - current);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Checks if the tables have been allocated.
+   */
+  [[nodiscard]] inline bool isPrepared() const noexcept
+  {
+    return !tables.empty();
+  }
+
+private:
+  //==============================================================================
+  /**
+   * @brief Gets the highest harmonic that doesn't alias within an octave.
+   * @param _level The octave table index.
+   */
+  [[nodiscard]] inline int getMaxHarmonic(const int _level) const noexcept
+  {
+    const float topFrequency = MIN_FREQUENCY * std::exp2(float(_level + 1));
+    const int harmonics = static_cast<int>(0.5f * sampleRate / topFrequency);
+    return std::clamp(harmonics, 0, TABLE_SIZE / 2 - 1);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Resynthesizes one octave table from the rendered spectrum.
+   * @param _level The octave table index.
+   */
+  inline void renderLevel(const int _level) noexcept
+  {
+    DSP_TRACER_COMPONENT("AnalogWavetable::renderLevel");
+    // The spectrum was taken over RENDER_SIZE samples, so its bins have to be
+    // rescaled before they can be transformed back with the smaller table FFT.
+    constexpr float binScale = float(TABLE_SIZE) / float(RENDER_SIZE);
+
+    std::fill(tableBuffer.begin(), tableBuffer.end(), 0.0f);
+    tableBuffer[0] = renderBuffer[0] * binScale;
+
+    const int maxHarmonic = getMaxHarmonic(_level);
+    for (int harmonic = 1; harmonic <= maxHarmonic; ++harmonic) {
+      const float real = renderBuffer[2 * harmonic] * binScale;
+      const float imag = renderBuffer[2 * harmonic + 1] * binScale;
+      const int mirror = TABLE_SIZE - harmonic;
+      tableBuffer[2 * harmonic] = real;
+      tableBuffer[2 * harmonic + 1] = imag;
+      tableBuffer[2 * mirror] = real;
+      tableBuffer[2 * mirror + 1] = -imag;
+    }
+
+    tableFft.performRealOnlyInverseTransform(tableBuffer.data());
+
+    float* table = tables.data() + _level * TABLE_STRIDE;
+    std::copy_n(tableBuffer.begin(), TABLE_SIZE, table);
+    table[TABLE_SIZE] = table[0];
+  }
+
+  //==============================================================================
+  float sampleRate = 44100.0f;
+  juce::dsp::FFT renderFft;
+  juce::dsp::FFT tableFft;
+  std::vector<float> tables;
+  std::vector<float> renderBuffer;
+  std::vector<float> tableBuffer;
+
+  //==============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogWavetable)
+};
+
+//==============================================================================
+} // namespace synth
+} // namespace dsp
+} // namespace dmt
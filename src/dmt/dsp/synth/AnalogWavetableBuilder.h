@@ -0,0 +1,159 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Shared background thread that renders the band-limited wavetables of the
+ * analog oscillators, so the audio thread never has to run an FFT.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace synth {
+
+//==============================================================================
+/**
+ * @class AnalogWavetableBuilder
+ * @brief Renders wavetables on behalf of the oscillators that use them.
+ *
+ * @details
+ * Sleeps until a client asks for new tables through notify() and then lets
+ * every client render whatever its audio thread asked for since the last
+ * round. Clients that didn't ask for anything return right away.
+ *
+ * Only one builder should exist per process, so it is meant to be held
+ * through a juce::SharedResourcePointer.
+ */
+class AnalogWavetableBuilder : public juce::Thread
+{
+  constexpr static int THREAD_TIMEOUT = 1000;
+
+public:
+  //============================================================================
+  /**
+   * @brief An owner of wavetables that are rendered by the builder.
+   */
+  class Client
+  {
+  public:
+    inline Client() noexcept = default;
+    inline virtual ~Client() noexcept = default;
+
+    //==========================================================================
+    /**
+     * @brief Renders the requested tables, if there are any.
+     *
+     * @details
+     * Called on the builder thread. Calls of the same builder never overlap.
+     */
+    virtual void buildWavetable() noexcept = 0;
+
+  private:
+    JUCE_DECLARE_NON_COPYABLE(Client)
+  };
+
+  //============================================================================
+  /**
+   * @brief Constructs the builder and starts its thread.
+   */
+  inline AnalogWavetableBuilder() noexcept
+    : juce::Thread("AnalogWavetableBuilder")
+  {
+    startThread(juce::Thread::Priority::normal);
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops the builder thread.
+   */
+  inline ~AnalogWavetableBuilder() noexcept override
+  {
+    stopThread(THREAD_TIMEOUT);
+  }
+
+  //============================================================================
+  /**
+   * @brief Adds a client. Must not be called from the audio thread.
+   * @param _client The client to build tables for.
+   */
+  inline void addClient(Client& _client) noexcept
+  {
+    const juce::ScopedLock lock(clientLock);
+    clients.addIfNotAlreadyThere(&_client);
+  }
+
+  //============================================================================
+  /**
+   * @brief Removes a client. Must not be called from the audio thread.
+   * @param _client The client to remove.
+   *
+   * @details
+   * Waits for a build of the client that is in progress, so once this returns
+   * the builder won't touch the client again.
+   */
+  inline void removeClient(Client& _client) noexcept
+  {
+    const juce::ScopedLock lock(clientLock);
+    clients.removeFirstMatchingValue(&_client);
+  }
+
+protected:
+  //============================================================================
+  /**
+   * @brief Builds the pending tables until the thread is asked to exit.
+   */
+  inline void run() override
+  {
+    while (!threadShouldExit()) {
+      wait(-1);
+      if (threadShouldExit())
+        return;
+
+      DSP_TRACER_COMPONENT("AnalogWavetableBuilder::run");
+      const juce::ScopedLock lock(clientLock);
+      for (auto* client : clients)
+        client->buildWavetable();
+    }
+  }
+
+private:
+  //============================================================================
+  juce::CriticalSection clientLock;
+  juce::Array<Client*> clients;
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalogWavetableBuilder)
+};
+
+//==============================================================================
+} // namespace synth
+} // namespace dsp
+} // namespace dmt
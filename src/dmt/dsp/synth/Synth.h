@@ -31,7 +31,11 @@
 
 #include "./AnalogOscillator.h"
 #include "./AnalogWaveform.h"
+#include "./AnalogWavetable.h"
+#include "./AnalogWavetableBuilder.h"
 #include "./SynthSound.h"
 #include "./SynthVoice.h"
+#include "./VoiceBank.h"
+#include "./VoiceBankSynthesiser.h"
 
 //==============================================================================
\ No newline at end of file
@@ -31,6 +31,7 @@
 
 #include "dsp/envelope/AdhEnvelope.h"
 #include "dsp/synth/AnalogOscillator.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -44,9 +45,17 @@ namespace synth {
 /**
  * @class SynthVoice
  * @brief A class representing a synthesizer voice.
+ *
+ * @details
+ * Every voice renders a single oscillator and ignores the unison parameters.
+ * VoiceBankSynthesiser renders the same parameters with unison for all notes
+ * at once and replaces a juce::Synthesiser filled with these voices.
  */
 class alignas(64) SynthVoice : public juce::SynthesiserVoice
 {
+  static constexpr int MAX_BLOCK_SIZE = 256;
+  using BlockBuffer = std::array<float, MAX_BLOCK_SIZE>;
+
 public:
   //==============================================================================
   /**
@@ -56,7 +65,7 @@ public:
   SynthVoice(juce::AudioProcessorValueTreeState& _apvts) noexcept
     : apvts(_apvts)
   {
-    TRACER("SynthVoice::SynthVoice");
+    DSP_TRACER_COMPONENT("SynthVoice::SynthVoice");
   }
 
   //==============================================================================
@@ -67,7 +76,7 @@ public:
    */
   bool canPlaySound(juce::SynthesiserSound* _sound) override
   {
-    TRACER("SynthVoice::canPlaySound");
+    DSP_TRACER_COMPONENT("SynthVoice::canPlaySound");
     return dynamic_cast<juce::SynthesiserSound*>(_sound) != nullptr;
   }
 
@@ -86,7 +95,7 @@ public:
   void controllerMoved(int /*controllerNumber*/,
                        int /*newControllerValue*/) noexcept override
   {
-    TRACER("SynthVoice::controllerMoved");
+    DSP_TRACER_COMPONENT("SynthVoice::controllerMoved");
   }
 
   //==============================================================================
@@ -100,7 +109,7 @@ public:
    */
   void pitchWheelMoved(int /*newPitchWheelValue*/) noexcept override
   {
-    TRACER("SynthVoice::pitchWheelMoved");
+    DSP_TRACER_COMPONENT("SynthVoice::pitchWheelMoved");
   }
 
   //==============================================================================
@@ -114,17 +123,35 @@ public:
                      int /*_samplesPerBlock*/,
                      int /*_outputChannels*/) noexcept
   {
-    TRACER("SynthVoice::prepareToPlay");
+    DSP_TRACER_COMPONENT("SynthVoice::prepareToPlay");
     if (_sampleRate <= 0)
       return;
 
     gainEnvelope.setSampleRate(static_cast<float>(_sampleRate));
     pitchEnvelope.setSampleRate(static_cast<float>(_sampleRate));
+    osc.setBackend(oscillatorBackend);
     osc.setSampleRate(static_cast<float>(_sampleRate));
 
     isPrepared = true;
   }
 
+  //==============================================================================
+  /**
+   * @brief Selects how the oscillator generates its waveform.
+   * @param _newBackend The new backend.
+   *
+   * @details
+   * Defaults to the direct backend. The band-limited wavetable backend
+   * quantizes bend, PWM and sync, so it is opt-in. Takes effect on the next
+   * call to prepareToPlay().
+   */
+  void setOscillatorBackend(
+    const AnalogOscillator::Backend _newBackend) noexcept
+  {
+    DSP_TRACER_COMPONENT("SynthVoice::setOscillatorBackend");
+    oscillatorBackend = _newBackend;
+  }
+
   //==============================================================================
   /**
    * @brief Starts a note.
@@ -138,7 +165,7 @@ public:
                  juce::SynthesiserSound* /*_sound*/,
                  int /*_currentPitchWheelPosition*/) noexcept override
   {
-    TRACER("SynthVoice::startNote");
+    DSP_TRACER_COMPONENT("SynthVoice::startNote");
     osc.setPhase(0.0f);
     note = _midiNoteNumber;
 
@@ -152,7 +179,7 @@ public:
   //==============================================================================
   void stopNote(float /*_velocity*/, bool /*_allowTailOff*/) noexcept override
   {
-    TRACER("SynthVoice::stopNote");
+    DSP_TRACER_COMPONENT("SynthVoice::stopNote");
   }
 
   /**
@@ -165,7 +192,7 @@ public:
                        int _startSample,
                        int _numSamples) noexcept override
   {
-    TRACER("SynthVoice::renderNextBlock");
+    DSP_TRACER_COMPONENT("SynthVoice::renderNextBlock");
     if (!isVoiceActive() || !isPrepared)
       return;
 
@@ -180,16 +207,23 @@ public:
     const float oscModDepth =
       apvts.getRawParameterValue("osc1PitchEnvDepth")->load();
 
-    const auto endSample = _numSamples + _startSample;
-    auto* leftChannel = _outputBuffer.getWritePointer(0);
-    auto* rightChannel = _outputBuffer.getWritePointer(1);
+    const float gain = juce::Decibels::decibelsToGain(oscGain, -96.0f);
+    auto* leftChannel = _outputBuffer.getWritePointer(0, _startSample);
+    auto* rightChannel = _outputBuffer.getWritePointer(1, _startSample);
+
+    for (int offset = 0; offset < _numSamples; offset += MAX_BLOCK_SIZE) {
+      const int numSamples = std::min(MAX_BLOCK_SIZE, _numSamples - offset);
+      auto* left = leftChannel + offset;
+      auto* right = rightChannel + offset;
 
-    for (int sample = _startSample; sample < endSample; ++sample) {
-      osc.setFrequency(getNextFrequency(oscOctave, oscSemitone, oscModDepth));
-      const auto rawSample = osc.getNextSample();
-      const auto gainedSample = applyGain(rawSample, oscGain);
-      leftChannel[sample] = gainedSample;
-      rightChannel[sample] = gainedSample;
+      renderFrequencies(numSamples, oscOctave, oscSemitone, oscModDepth);
+      osc.renderBlock(left, frequencyBuffer.data(), numSamples);
+
+      gainEnvelope.renderBlock(gainBuffer.data(), numSamples);
+      juce::FloatVectorOperations::multiply(
+        left, gainBuffer.data(), numSamples);
+      juce::FloatVectorOperations::multiply(left, gain, numSamples);
+      juce::FloatVectorOperations::copy(right, left, numSamples);
     }
   }
 
@@ -200,7 +234,7 @@ public:
    */
   void addOnNoteReceivers(std::function<void()> _callbackFunction) noexcept
   {
-    TRACER("SynthVoice::addOnNoteReceivers");
+    DSP_TRACER_COMPONENT("SynthVoice::addOnNoteReceivers");
     onNoteReceivers.push_back(std::move(_callbackFunction));
   }
 
@@ -210,7 +244,7 @@ public:
    */
   void callOnNoteReceivers() noexcept
   {
-    TRACER("SynthVoice::callOnNoteReceivers");
+    DSP_TRACER_COMPONENT("SynthVoice::callOnNoteReceivers");
     for (const auto& func : onNoteReceivers) {
       func();
     }
@@ -224,7 +258,7 @@ protected:
    */
   void updateEnvelopeParameters() noexcept
   {
-    TRACER("SynthVoice::updateEnvelopeParameters");
+    DSP_TRACER_COMPONENT("SynthVoice::updateEnvelopeParameters");
     dmt::dsp::envelope::AhdEnvelope::Parameters gainEnvParameters;
     gainEnvParameters.attack =
       apvts.getRawParameterValue("osc1GainEnvAttack")->load();
@@ -256,7 +290,7 @@ protected:
    */
   void updateOscillatorParameters() noexcept
   {
-    TRACER("SynthVoice::updateOscillatorParameters");
+    DSP_TRACER_COMPONENT("SynthVoice::updateOscillatorParameters");
     osc.setWaveformType(static_cast<dmt::dsp::synth::AnalogWaveform::Type>(
       apvts.getRawParameterValue("osc1WaveformType")->load()));
     osc.setDrive(apvts.getRawParameterValue("osc1DistortionType")->load());
@@ -268,50 +302,51 @@ protected:
 
   //==============================================================================
   /**
-   * @brief Calculates the next frequency for the oscillator.
+   * @brief Renders the oscillator frequencies of the next block.
+   * @param _numSamples The number of samples to render.
    * @param _rawOctave The raw octave value.
    * @param _rawSemitone The raw semitone value.
    * @param _rawModDepth The raw modulation depth.
-   * @return The next frequency.
+   *
+   * @details
+   * The base and maximum frequency only depend on the note and the parameters,
+   * so they are computed once per block. The pitch envelope is rendered into
+   * the frequency buffer and then mapped from the logarithmic range in place.
    */
-  [[nodiscard]] float getNextFrequency(const int _rawOctave,
-                                       const int _rawSemitone,
-                                       const float _rawModDepth) noexcept
+  void renderFrequencies(const int _numSamples,
+                         const int _rawOctave,
+                         const int _rawSemitone,
+                         const float _rawModDepth) noexcept
   {
-    TRACER("SynthVoice::getNextFrequency");
+    DSP_TRACER_COMPONENT("SynthVoice::renderFrequencies");
     const int octaves = 12 * _rawOctave;
     const int semitone = octaves + _rawSemitone;
     const int baseNote = note + semitone;
-    const float baseFreq = juce::MidiMessage::getMidiNoteInHertz(baseNote);
+    const float baseFreq =
+      static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(baseNote));
     const float modDepth = _rawModDepth * 2e4f;
-    const float envelopeSample = pitchEnvelope.getNextSample();
     const float maxFreq = std::clamp(baseFreq + modDepth, baseFreq, 2e4f);
-    const float newFreq = juce::mapToLog10(envelopeSample, baseFreq, maxFreq);
-    return std::clamp(newFreq, 20.0f, 2e4f);
-  }
+    const float logRange = std::log(maxFreq / baseFreq);
 
-  //==============================================================================
-  /**
-   * @brief Applies gain to a sample.
-   * @param _sample The input sample.
-   * @param _oscGain The oscillator gain.
-   * @return The gained sample.
-   */
-  [[nodiscard]] float applyGain(float _sample, float _oscGain) noexcept
-  {
-    TRACER("SynthVoice::applyGain");
-    const float envGain = gainEnvelope.getNextSample();
-    const float gain = juce::Decibels::decibelsToGain(_oscGain, -96.0f);
-    return _sample * envGain * gain;
+    auto* frequencies = frequencyBuffer.data();
+    pitchEnvelope.renderBlock(frequencies, _numSamples);
+    for (int i = 0; i < _numSamples; ++i) {
+      const float newFreq = baseFreq * std::exp(frequencies[i] * logRange);
+      frequencies[i] = std::clamp(newFreq, 20.0f, 2e4f);
+    }
   }
 
 private:
   juce::AudioProcessorValueTreeState& apvts;
   dmt::dsp::synth::AnalogOscillator osc;
+  AnalogOscillator::Backend oscillatorBackend =
+    AnalogOscillator::Backend::Direct;
   dmt::dsp::envelope::AhdEnvelope gainEnvelope;
   dmt::dsp::envelope::AhdEnvelope pitchEnvelope;
   int note = 0;
   bool isPrepared = false;
+  alignas(16) BlockBuffer frequencyBuffer{};
+  alignas(16) BlockBuffer gainBuffer{};
   std::vector<std::function<void()>> onNoteReceivers;
 };
 
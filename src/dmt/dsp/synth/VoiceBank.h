@@ -0,0 +1,696 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Fixed-size polyphonic voice bank that renders all unison voices of all
+ * notes as structure-of-arrays, so they can be processed many per register.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "dsp/envelope/AdhEnvelope.h"
+#include "dsp/synth/AnalogWaveform.h"
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace synth {
+
+//==============================================================================
+
+/**
+ * @class VoiceBank
+ * @brief Polyphonic, unison capable synth renderer with a fixed voice pool.
+ *
+ * @tparam NumNotes The number of notes that can play at the same time.
+ *
+ * @details
+ * Every note owns a fixed group of UNISON_LANES oscillator lanes. The lane
+ * state (phase, detune ratio and stereo gains) is stored as structure of
+ * arrays, and the per-sample loop runs over the lanes of a note with no
+ * branches or calls, so the compiler processes 4 or 8 lanes per SIMD
+ * register. Lanes beyond the current density simply have zero gain.
+ *
+ * The envelopes are rendered once per note and block, and the waveform is
+ * dispatched once per block. Shapes follow AnalogOscillator, but sine and tanh
+ * use the rational approximations from FastMathApproximations and the phase
+ * is normalized to [0, 1).
+ *
+ * Notes are allocated from the fixed pool without any allocation. If all
+ * notes are busy, the oldest one is stolen.
+ *
+ * The unison voices are spread over the detune and stereo range by the
+ * distribution curve. Their start phases are set on every note on from the
+ * phase offset, and the randomness scatters them by values taken from the
+ * seed.
+ */
+template<size_t NumNotes = 8>
+class alignas(64) VoiceBank
+{
+  using Math = juce::dsp::FastMathApproximations;
+  using Envelope = dmt::dsp::envelope::AhdEnvelope;
+  using Type = AnalogWaveform::Type;
+  static constexpr float pi = juce::MathConstants<float>::pi;
+  static constexpr float twoPi = juce::MathConstants<float>::twoPi;
+
+public:
+  //==============================================================================
+  /**
+   * @brief How the unison voices are spread, in the order of the parameter.
+   */
+  enum class Distribution
+  {
+    Linear,
+    Quadratic,
+    Cubic,
+    Octic,
+    SquareRoot,
+    CubeRoot,
+    OcticRoot,
+    Sine,
+    Random
+  };
+
+  //==============================================================================
+  /**
+   * @brief Where the random start phases come from, in the order of the
+   * parameter.
+   *
+   * @details
+   * Random draws new values for every note. Equal spaces the voices evenly
+   * over the cycle. The static seeds give every note the same values.
+   */
+  enum class Seed
+  {
+    Random,
+    Equal,
+    Static1,
+    Static2,
+    Static3,
+    Static4,
+    Static5
+  };
+
+  //==============================================================================
+  static constexpr int UNISON_LANES = 8;
+  static constexpr int NUM_LANES = int(NumNotes) * UNISON_LANES;
+  static constexpr int MAX_BLOCK_SIZE = 256;
+
+  using LaneArray = std::array<float, NUM_LANES>;
+  using BlockBuffer = std::array<float, MAX_BLOCK_SIZE>;
+
+  //==============================================================================
+  VoiceBank() noexcept
+  {
+    updateUnison();
+    setDistortion(0.0f, 0.0f);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Prepares the bank for the given sample rate and stops all notes.
+   * @param _sampleRate The sample rate in Hz.
+   */
+  inline void prepare(const float _sampleRate) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBank::prepare");
+    sampleRate = _sampleRate;
+    for (auto& note : notes) {
+      note.gainEnvelope.setSampleRate(sampleRate);
+      note.pitchEnvelope.setSampleRate(sampleRate);
+      note.isActive = false;
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the envelope parameters used by all notes.
+   * @param _gain The gain envelope parameters.
+   * @param _pitch The pitch envelope parameters.
+   */
+  inline void setEnvelopeParameters(const Envelope::Parameters& _gain,
+                                    const Envelope::Parameters& _pitch) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBank::setEnvelopeParameters");
+    for (auto& note : notes) {
+      note.gainEnvelope.setParameters(_gain);
+      note.pitchEnvelope.setParameters(_pitch);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the pitch offset and the pitch envelope depth.
+   * @param _octave The octave offset.
+   * @param _semitone The semitone offset.
+   * @param _modDepth The pitch envelope depth in the range [0, 1].
+   */
+  inline void setPitch(const int _octave,
+                       const int _semitone,
+                       const float _modDepth) noexcept
+  {
+    transpose = 12 * _octave + _semitone;
+    modDepth = _modDepth * 2e4f;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the output gain of all notes.
+   * @param _gain The linear gain.
+   */
+  inline void setGain(const float _gain) noexcept { outputGain = _gain; }
+
+  //==============================================================================
+  /**
+   * @brief Sets the shape of all oscillators.
+   * @param _type The waveform type.
+   * @param _bend The bend modifier in the range [-100, 100].
+   * @param _pwm The PWM modifier in the range [0, 100].
+   * @param _sync The sync modifier in the range [0, 100].
+   */
+  inline void setShape(const Type _type,
+                       const float _bend,
+                       const float _pwm,
+                       const float _sync) noexcept
+  {
+    type = _type;
+    positiveCycleRatio = juce::jmap(_bend, -100.0f, 100.0f, 0.1f, 0.9f);
+    pwmModifier = juce::jmap(_pwm, 0.0f, 100.0f, 1.0f, 5.0f);
+    syncModifier = juce::jmap(_sync, 0.0f, 100.0f, 1.0f, 5.0f);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the distortion of all oscillators.
+   * @param _drive The drive level.
+   * @param _bias The bias level.
+   *
+   * @details
+   * The two cases of AnalogOscillator::distortSample() are folded into one
+   * expression here, so the lane loop doesn't branch on the drive.
+   */
+  inline void setDistortion(const float _drive, const float _bias) noexcept
+  {
+    constexpr float magicNumber = 0.7615941559558f;
+    const bool isSaturated = _drive >= 1.0f;
+    preGain = isSaturated ? _drive : 1.0f;
+    wetGain = isSaturated ? 1.0f : _drive;
+    dryGain = isSaturated ? 0.0f : (1.0f - _drive) * magicNumber;
+    bias = _bias;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the unison configuration.
+   * @param _density The number of unison voices in the range [1, 8].
+   * @param _detune The detune amount in the range [0, 100] cents.
+   * @param _distribution The curve the voices are spread along.
+   * @param _width The stereo width in the range [0, 100].
+   *
+   * @details
+   * The lanes are only recomputed when the configuration changed, so this is
+   * cheap enough to call for every block.
+   */
+  inline void setUnison(const int _density,
+                        const float _detune,
+                        const Distribution _distribution,
+                        const float _width) noexcept
+  {
+    const int density = std::clamp(_density, 1, UNISON_LANES);
+    if (density == unisonDensity && _detune == unisonDetune &&
+        _distribution == unisonDistribution && _width == unisonWidth)
+      return;
+
+    unisonDensity = density;
+    unisonDetune = _detune;
+    unisonDistribution = _distribution;
+    unisonWidth = _width;
+    updateUnison();
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the start phases of the unison voices.
+   * @param _phase The phase offset in the range [0, 100] percent of a cycle.
+   * @param _randomness How far the voices are scattered from the offset, in
+   * the range [0, 100] percent of a cycle.
+   * @param _seed Where the scattering values come from.
+   *
+   * @details
+   * Takes effect with the next note on.
+   */
+  inline void setPhase(const float _phase,
+                       const float _randomness,
+                       const Seed _seed) noexcept
+  {
+    phaseOffset = _phase * 0.01f;
+    phaseRandomness = _randomness * 0.01f;
+    phaseSeed = _seed;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Starts a note, stealing the oldest one if the pool is full.
+   * @param _midiNoteNumber The MIDI note number.
+   */
+  inline void noteOn(const int _midiNoteNumber) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBank::noteOn");
+    const size_t index = findFreeNote();
+    auto& note = notes[index];
+    note.midiNoteNumber = _midiNoteNumber;
+    note.startIndex = ++noteCounter;
+    note.isActive = true;
+    note.gainEnvelope.noteOn();
+    note.pitchEnvelope.noteOn();
+
+    resetPhases(index);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Stops all notes immediately.
+   */
+  inline void allNotesOff() noexcept
+  {
+    for (auto& note : notes)
+      note.isActive = false;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders a block and handles the MIDI events inside of it.
+   * @param _outputBuffer The buffer to add the stereo output to.
+   * @param _midiMessages The MIDI events of the block.
+   * @param _startSample The first sample to render.
+   * @param _numSamples The number of samples to render.
+   *
+   * @details
+   * The block is split at every note on, like juce::Synthesiser does, but
+   * without any per-voice virtual dispatch. AHD envelopes have no release,
+   * so note offs are ignored and notes end when their envelope is idle.
+   */
+  inline void renderNextBlock(juce::AudioBuffer<float>& _outputBuffer,
+                              const juce::MidiBuffer& _midiMessages,
+                              const int _startSample,
+                              const int _numSamples) noexcept
+  {
+    DSP_TRACER_BLOCK("VoiceBank::renderNextBlock");
+    if (sampleRate <= 0.0f || _outputBuffer.getNumChannels() < 2)
+      return;
+
+    auto* left = _outputBuffer.getWritePointer(0);
+    auto* right = _outputBuffer.getWritePointer(1);
+    const int endSample = _startSample + _numSamples;
+    int position = _startSample;
+
+    for (const auto metadata : _midiMessages) {
+      const int eventPosition = std::clamp(
+        metadata.samplePosition, _startSample, endSample);
+      render(left + position, right + position, eventPosition - position);
+      position = eventPosition;
+
+      const auto message = metadata.getMessage();
+      if (message.isNoteOn())
+        noteOn(message.getNoteNumber());
+      else if (message.isAllNotesOff() || message.isAllSoundOff())
+        allNotesOff();
+    }
+
+    render(left + position, right + position, endSample - position);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders all active notes and adds them to the output.
+   * @param _left The left output channel.
+   * @param _right The right output channel.
+   * @param _numSamples The number of samples to render.
+   */
+  inline void render(float* _left,
+                     float* _right,
+                     const int _numSamples) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBank::render");
+    for (int offset = 0; offset < _numSamples; offset += MAX_BLOCK_SIZE) {
+      const int numSamples = std::min(MAX_BLOCK_SIZE, _numSamples - offset);
+      for (size_t index = 0; index < NumNotes; ++index) {
+        if (!notes[index].isActive)
+          continue;
+        renderNote(index, _left + offset, _right + offset, numSamples);
+      }
+    }
+  }
+
+private:
+  //==============================================================================
+  struct Note
+  {
+    Envelope gainEnvelope;
+    Envelope pitchEnvelope;
+    int midiNoteNumber = 0;
+    uint64_t startIndex = 0;
+    bool isActive = false;
+  };
+
+  //==============================================================================
+  /**
+   * @brief Computes the detune ratios and stereo gains of the lanes.
+   *
+   * @details
+   * Every voice is placed at a position in [-1, 1], which is shaped by the
+   * distribution and then scaled by the detune and the width. The gain of
+   * every voice is scaled so that the overall loudness stays roughly constant.
+   */
+  inline void updateUnison() noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBank::updateUnison");
+    const int density = unisonDensity;
+    const float voiceGain = 1.0f / std::sqrt(static_cast<float>(density));
+    const float width = unisonWidth * 0.01f;
+
+    // Seeded by the density, so the random spread stays the same across blocks
+    // and sessions for the same configuration
+    juce::Random random(density);
+
+    std::array<float, UNISON_LANES> ratios{};
+    std::array<float, UNISON_LANES> lefts{};
+    std::array<float, UNISON_LANES> rights{};
+    for (int lane = 0; lane < density; ++lane) {
+      const float position =
+        density > 1 ? 2.0f * float(lane) / float(density - 1) - 1.0f : 0.0f;
+      const float spread =
+        unisonDistribution == Distribution::Random && density > 1
+          ? 2.0f * random.nextFloat() - 1.0f
+          : distribute(position, unisonDistribution);
+      ratios[lane] = std::exp2(spread * unisonDetune / 1200.0f);
+      const float pan = spread * width;
+      lefts[lane] = voiceGain * 0.5f * (1.0f - pan);
+      rights[lane] = voiceGain * 0.5f * (1.0f + pan);
+    }
+
+    for (int offset = 0; offset < NUM_LANES; offset += UNISON_LANES) {
+      std::copy(ratios.begin(), ratios.end(), detuneRatios.begin() + offset);
+      std::copy(lefts.begin(), lefts.end(), leftGains.begin() + offset);
+      std::copy(rights.begin(), rights.end(), rightGains.begin() + offset);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Shapes a linear voice position with a distribution curve.
+   * @param _position The position in the range [-1, 1].
+   * @param _distribution The curve.
+   * @return The shaped position in the range [-1, 1].
+   *
+   * @details
+   * The curves are applied to the distance from the center, so the voices
+   * stay symmetric. Powers above one pull them to the center, roots push them
+   * outwards.
+   */
+  [[nodiscard]] static inline float distribute(
+    const float _position,
+    const Distribution _distribution) noexcept
+  {
+    const float distance = std::abs(_position);
+    float shaped = distance;
+    switch (_distribution) {
+      case Distribution::Linear:
+      case Distribution::Random:
+        break;
+      case Distribution::Quadratic:
+        shaped = distance * distance;
+        break;
+      case Distribution::Cubic:
+        shaped = distance * distance * distance;
+        break;
+      case Distribution::Octic:
+        shaped = std::pow(distance, 8.0f);
+        break;
+      case Distribution::SquareRoot:
+        shaped = std::sqrt(distance);
+        break;
+      case Distribution::CubeRoot:
+        shaped = std::cbrt(distance);
+        break;
+      case Distribution::OcticRoot:
+        shaped = std::pow(distance, 0.125f);
+        break;
+      case Distribution::Sine:
+        shaped = std::sin(distance * pi * 0.5f);
+        break;
+    }
+    return std::copysign(shaped, _position);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the start phases of the lanes of a note.
+   * @param _index The index of the note.
+   */
+  inline void resetPhases(const size_t _index) noexcept
+  {
+    const int firstLane = int(_index) * UNISON_LANES;
+    const int seedIndex = static_cast<int>(phaseSeed);
+    juce::Random staticRandom(seedIndex);
+    auto& random = phaseSeed == Seed::Random ? phaseRandom : staticRandom;
+
+    for (int lane = 0; lane < UNISON_LANES; ++lane) {
+      const float scatter = phaseSeed == Seed::Equal
+                              ? float(lane) / float(unisonDensity)
+                              : random.nextFloat();
+      float phase = phaseOffset + phaseRandomness * scatter;
+      phase -= static_cast<float>(static_cast<int>(phase));
+      phases[size_t(firstLane + lane)] = phase;
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Finds a free note, or the oldest one if all are in use.
+   * @return The index of the note.
+   */
+  [[nodiscard]] inline size_t findFreeNote() const noexcept
+  {
+    size_t oldest = 0;
+    for (size_t index = 0; index < NumNotes; ++index) {
+      if (!notes[index].isActive)
+        return index;
+      if (notes[index].startIndex < notes[oldest].startIndex)
+        oldest = index;
+    }
+    return oldest;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders one note with all of its unison lanes.
+   * @param _index The index of the note.
+   * @param _left The left output channel.
+   * @param _right The right output channel.
+   * @param _numSamples The number of samples, at most MAX_BLOCK_SIZE.
+   */
+  inline void renderNote(const size_t _index,
+                         float* _left,
+                         float* _right,
+                         const int _numSamples) noexcept
+  {
+    auto& note = notes[_index];
+    if (note.gainEnvelope.getState() == Envelope::State::Idle) {
+      note.isActive = false;
+      return;
+    }
+
+    renderFrequencies(note, _numSamples);
+    note.gainEnvelope.renderBlock(gainBuffer.data(), _numSamples);
+    juce::FloatVectorOperations::multiply(
+      gainBuffer.data(), outputGain, _numSamples);
+
+    const int firstLane = int(_index) * UNISON_LANES;
+    switch (type) {
+      case Type::Sine:
+        renderLanes<Type::Sine>(firstLane, _left, _right, _numSamples);
+        break;
+      case Type::Saw:
+        renderLanes<Type::Saw>(firstLane, _left, _right, _numSamples);
+        break;
+      case Type::Triangle:
+        renderLanes<Type::Triangle>(firstLane, _left, _right, _numSamples);
+        break;
+      case Type::Square:
+        renderLanes<Type::Square>(firstLane, _left, _right, _numSamples);
+        break;
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders the base frequency of a note into the frequency buffer.
+   * @param _note The note.
+   * @param _numSamples The number of samples to render.
+   */
+  inline void renderFrequencies(Note& _note, const int _numSamples) noexcept
+  {
+    const int baseNote = _note.midiNoteNumber + transpose;
+    const float baseFreq =
+      static_cast<float>(juce::MidiMessage::getMidiNoteInHertz(baseNote));
+    const float maxFreq = std::clamp(baseFreq + modDepth, baseFreq, 2e4f);
+    const float logRange = std::log(maxFreq / baseFreq);
+
+    auto* frequencies = frequencyBuffer.data();
+    _note.pitchEnvelope.renderBlock(frequencies, _numSamples);
+    for (int i = 0; i < _numSamples; ++i) {
+      const float newFreq = baseFreq * std::exp(frequencies[i] * logRange);
+      frequencies[i] = std::clamp(newFreq, 20.0f, 2e4f);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders the unison lanes of a note.
+   * @tparam WaveformType The current waveform type.
+   * @param _firstLane The index of the first lane of the note.
+   * @param _left The left output channel.
+   * @param _right The right output channel.
+   * @param _numSamples The number of samples to render.
+   */
+  template<Type WaveformType>
+  inline void renderLanes(const int _firstLane,
+                          float* _left,
+                          float* _right,
+                          const int _numSamples) noexcept
+  {
+    float* phase = phases.data() + _firstLane;
+    const float* ratio = detuneRatios.data() + _firstLane;
+    const float* leftGain = leftGains.data() + _firstLane;
+    const float* rightGain = rightGains.data() + _firstLane;
+
+    const float invSampleRate = 1.0f / sampleRate;
+    const float cycleEnd = 1.0f / pwmModifier;
+    const float phaseScale = pwmModifier * syncModifier;
+    const float ratioA = 0.5f / positiveCycleRatio;
+    const float ratioB = 0.5f / (1.0f - positiveCycleRatio);
+
+    for (int i = 0; i < _numSamples; ++i) {
+      const float increment = frequencyBuffer[i] * invSampleRate;
+      const float gain = gainBuffer[i];
+      float leftSum = 0.0f;
+      float rightSum = 0.0f;
+
+      for (int lane = 0; lane < UNISON_LANES; ++lane) {
+        float p = phase[lane] + increment * ratio[lane];
+        p -= p >= 1.0f ? 1.0f : 0.0f;
+        phase[lane] = p;
+
+        // The phase is never negative, so truncation equals floor here, and
+        // unlike std::floor it vectorizes without SSE4.1.
+        float synced = p * phaseScale;
+        synced -= static_cast<float>(static_cast<int>(synced));
+
+        const float bended =
+          synced <= positiveCycleRatio
+            ? synced * ratioA
+            : 0.5f + (synced - positiveCycleRatio) * ratioB;
+
+        const float raw = getShape<WaveformType>(bended);
+        const float distorted =
+          wetGain * Math::tanh(preGain * raw) + dryGain * raw + bias;
+        const float clamped = std::clamp(distorted, -1.0f, 1.0f);
+        const float sample = p < cycleEnd ? clamped * gain : 0.0f;
+
+        leftSum += sample * leftGain[lane];
+        rightSum += sample * rightGain[lane];
+      }
+
+      _left[i] += leftSum;
+      _right[i] += rightSum;
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Computes a waveform for a normalized phase without branches.
+   * @tparam WaveformType The waveform type.
+   * @param _phase The normalized phase in the range [0, 1).
+   * @return The waveform sample.
+   */
+  template<Type WaveformType>
+  [[nodiscard]] static forcedinline float getShape(const float _phase) noexcept
+  {
+    if constexpr (WaveformType == Type::Sine) {
+      return -Math::sin(_phase * twoPi - pi);
+    } else if constexpr (WaveformType == Type::Saw) {
+      return 2.0f * _phase - 1.0f;
+    } else if constexpr (WaveformType == Type::Triangle) {
+      float shifted = _phase + 0.25f;
+      shifted -= static_cast<float>(static_cast<int>(shifted));
+      return 2.0f * std::abs(2.0f * shifted - 1.0f) - 1.0f;
+    } else {
+      return _phase < 0.5f ? 1.0f : -1.0f;
+    }
+  }
+
+  //==============================================================================
+  float sampleRate = -1.0f;
+  Type type = Type::Sine;
+  float positiveCycleRatio = 0.5f;
+  float pwmModifier = 1.0f;
+  float syncModifier = 1.0f;
+  float preGain = 1.0f;
+  float wetGain = 0.0f;
+  float dryGain = 0.0f;
+  float bias = 0.0f;
+  int transpose = 0;
+  float modDepth = 0.0f;
+  float outputGain = 1.0f;
+  int unisonDensity = 1;
+  float unisonDetune = 0.0f;
+  Distribution unisonDistribution = Distribution::Linear;
+  float unisonWidth = 0.0f;
+  float phaseOffset = 0.0f;
+  float phaseRandomness = 0.0f;
+  Seed phaseSeed = Seed::Random;
+  juce::Random phaseRandom;
+  uint64_t noteCounter = 0;
+  std::array<Note, NumNotes> notes{};
+
+  alignas(32) LaneArray phases{};
+  alignas(32) LaneArray detuneRatios{};
+  alignas(32) LaneArray leftGains{};
+  alignas(32) LaneArray rightGains{};
+  alignas(32) BlockBuffer frequencyBuffer{};
+  alignas(32) BlockBuffer gainBuffer{};
+
+  //==============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VoiceBank)
+};
+
+//==============================================================================
+} // namespace synth
+} // namespace dsp
+} // namespace dmt
@@ -0,0 +1,251 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Synthesiser that renders the oscillator parameters of a plugin through a
+ * VoiceBank instead of one juce::SynthesiserVoice per note.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "dsp/synth/VoiceBank.h"
+#include "utility/Tracer.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace dsp {
+namespace synth {
+
+//==============================================================================
+
+/**
+ * @class VoiceBankSynthesiser
+ * @brief Drop-in replacement for a juce::Synthesiser filled with SynthVoices.
+ *
+ * @details
+ * Reads the same osc1 parameters as SynthVoice, plus the unison parameters
+ * of the voice group, and hands them to a VoiceBank once per block. All notes
+ * and their unison voices are then rendered by the bank, without any
+ * per-voice virtual dispatch.
+ *
+ * The parameters are looked up once in the constructor, so rendering never
+ * touches the parameter tree.
+ */
+class VoiceBankSynthesiser
+{
+  using Bank = VoiceBank<>;
+  using Envelope = dmt::dsp::envelope::AhdEnvelope;
+
+  // The parameters read for every block, in the order of the Parameter enum
+  static constexpr std::array<const char*, 24> parameterIds = {
+    "osc1GainEnvAttack",     "osc1GainEnvHold",        "osc1GainEnvDecay",
+    "osc1GainEnvSkew",       "osc1PitchEnvHold",       "osc1PitchEnvDecay",
+    "osc1PitchEnvSkew",      "osc1PitchEnvDepth",      "osc1VoiceOctave",
+    "osc1VoiceSemitone",     "osc1DistortionPreGain",  "osc1WaveformType",
+    "osc1WaveformBend",      "osc1WaveformPwm",        "osc1WaveformSync",
+    "osc1DistortionType",    "osc1DistortionSymmetry", "osc1VoiceDensity",
+    "osc1VoiceDetune",       "osc1VoiceDistribution",  "osc1VoiceWidth",
+    "osc1VoicePhase",        "osc1VoiceRandom",        "osc1VoiceSeed"
+  };
+
+  enum Parameter
+  {
+    GainAttack,
+    GainHold,
+    GainDecay,
+    GainSkew,
+    PitchHold,
+    PitchDecay,
+    PitchSkew,
+    PitchDepth,
+    Octave,
+    Semitone,
+    PreGain,
+    WaveformType,
+    Bend,
+    Pwm,
+    Sync,
+    Drive,
+    Bias,
+    Density,
+    Detune,
+    Distribution,
+    Width,
+    Phase,
+    Randomness,
+    Seed
+  };
+
+public:
+  //==============================================================================
+  /**
+   * @brief Constructor for VoiceBankSynthesiser.
+   * @param _apvts Reference to the AudioProcessorValueTreeState.
+   */
+  VoiceBankSynthesiser(juce::AudioProcessorValueTreeState& _apvts) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::VoiceBankSynthesiser");
+    for (size_t i = 0; i < parameterIds.size(); ++i) {
+      parameters[i] = _apvts.getRawParameterValue(parameterIds[i]);
+      jassert(parameters[i] != nullptr);
+    }
+  }
+
+  //==============================================================================
+  /**
+   * @brief Prepares the synthesiser to play and stops all notes.
+   * @param _sampleRate The sample rate.
+   * @param _samplesPerBlock Number of samples per block.
+   * @param _outputChannels Number of output channels.
+   */
+  void prepareToPlay(double _sampleRate,
+                     int /*_samplesPerBlock*/,
+                     int /*_outputChannels*/) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::prepareToPlay");
+    if (_sampleRate <= 0)
+      return;
+
+    bank.prepare(static_cast<float>(_sampleRate));
+  }
+
+  //==============================================================================
+  /**
+   * @brief Renders the next block of audio.
+   * @param _outputBuffer The buffer to add the stereo output to.
+   * @param _midiMessages The MIDI events of the block.
+   * @param _startSample The start sample index.
+   * @param _numSamples The number of samples to render.
+   */
+  void renderNextBlock(juce::AudioBuffer<float>& _outputBuffer,
+                       const juce::MidiBuffer& _midiMessages,
+                       int _startSample,
+                       int _numSamples) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::renderNextBlock");
+    updateParameters();
+
+    for (const auto metadata : _midiMessages) {
+      if (metadata.getMessage().isNoteOn())
+        callOnNoteReceivers();
+    }
+
+    bank.renderNextBlock(
+      _outputBuffer, _midiMessages, _startSample, _numSamples);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Adds a callback function to be called when a note is received.
+   * @param _callbackFunction The callback function.
+   */
+  void addOnNoteReceivers(std::function<void()> _callbackFunction) noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::addOnNoteReceivers");
+    onNoteReceivers.push_back(std::move(_callbackFunction));
+  }
+
+  //==============================================================================
+  /**
+   * @brief Calls all registered note receiver callback functions.
+   */
+  void callOnNoteReceivers() noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::callOnNoteReceivers");
+    for (const auto& func : onNoteReceivers) {
+      func();
+    }
+  }
+
+protected:
+  //==============================================================================
+  /**
+   * @brief Hands the current parameter values to the bank.
+   */
+  void updateParameters() noexcept
+  {
+    DSP_TRACER_COMPONENT("VoiceBankSynthesiser::updateParameters");
+    Envelope::Parameters gainEnvParameters;
+    gainEnvParameters.attack = getValue(GainAttack);
+    gainEnvParameters.hold = getValue(GainHold);
+    gainEnvParameters.decay = getValue(GainDecay);
+    gainEnvParameters.decaySkew = getValue(GainSkew);
+    gainEnvParameters.attackSkew = 0;
+
+    Envelope::Parameters pitchEnvParameters;
+    pitchEnvParameters.attack = 0;
+    pitchEnvParameters.hold = getValue(PitchHold);
+    pitchEnvParameters.decay = getValue(PitchDecay);
+    pitchEnvParameters.decaySkew = getValue(PitchSkew);
+    pitchEnvParameters.attackSkew = 0;
+    bank.setEnvelopeParameters(gainEnvParameters, pitchEnvParameters);
+
+    bank.setPitch(static_cast<int>(getValue(Octave)),
+                  static_cast<int>(getValue(Semitone)),
+                  getValue(PitchDepth));
+    bank.setGain(juce::Decibels::decibelsToGain(getValue(PreGain), -96.0f));
+    bank.setShape(static_cast<AnalogWaveform::Type>(getValue(WaveformType)),
+                  getValue(Bend),
+                  getValue(Pwm),
+                  getValue(Sync));
+    bank.setDistortion(getValue(Drive), getValue(Bias));
+    bank.setUnison(static_cast<int>(getValue(Density)),
+                   getValue(Detune),
+                   static_cast<Bank::Distribution>(getValue(Distribution)),
+                   getValue(Width));
+    bank.setPhase(getValue(Phase),
+                  getValue(Randomness),
+                  static_cast<Bank::Seed>(getValue(Seed)));
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the current value of a parameter.
+   * @param _parameter The parameter.
+   * @return The denormalised value.
+   */
+  [[nodiscard]] float getValue(const Parameter _parameter) const noexcept
+  {
+    return parameters[size_t(_parameter)]->load(std::memory_order_relaxed);
+  }
+
+private:
+  Bank bank;
+  std::array<std::atomic<float>*, parameterIds.size()> parameters{};
+  std::vector<std::function<void()>> onNoteReceivers;
+
+  //==============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VoiceBankSynthesiser)
+};
+
+//==============================================================================
+
+} // namespace synth
+} // namespace dsp
+} // namespace dmt
+
+//==============================================================================
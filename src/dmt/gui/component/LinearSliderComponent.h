@@ -38,6 +38,7 @@
 #include "utility/HostContextMenu.h"
 #include "utility/Icon.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -105,7 +106,7 @@ public:
     , svgTitle(_svgTitle)
     , svgPadding(dmt::icons::getPadding(_param))
   {
-    TRACER("LinearSliderComponent::LinearSliderComponent");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::LinearSliderComponent");
     slider.addListener(this);
     updateLabel(static_cast<float>(slider.getValue()));
     addAndMakeVisible(slider);
@@ -132,7 +133,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("LinearSliderComponent::resized");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::resized");
     const auto bounds = getLocalBounds();
     const auto padding = rawPadding * this->size;
 
@@ -229,7 +230,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) override
   {
-    TRACER("LinearSliderComponent::paint");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::paint");
     auto bounds = getLocalBounds();
 
     // Draw bounds debug
@@ -256,7 +257,7 @@ public:
    */
   inline void sliderValueChanged(juce::Slider* /*_slider*/) override
   {
-    TRACER("LinearSliderComponent::sliderValueChanged");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::sliderValueChanged");
     updateLabel(static_cast<float>(slider.getValue()));
   }
 
@@ -273,7 +274,7 @@ public:
   inline void setBoundsByPoints(juce::Point<int> _primaryPoint,
                                 juce::Point<int> _secondaryPoint) noexcept
   {
-    TRACER("LinearSliderComponent::setBoundsByPoints");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::setBoundsByPoints");
     const float padding = 2.0f * rawPadding * this->size;
     const float minHeight = 50 * this->size;
     const float minWidth = 40 * this->size;
@@ -309,7 +310,7 @@ public:
    */
   [[nodiscard]] inline juce::Slider& getSlider() noexcept
   {
-    TRACER("LinearSliderComponent::getSlider");
+    GUI_TRACER_COMPONENT("LinearSliderComponent::getSlider");
     return slider;
   }
 
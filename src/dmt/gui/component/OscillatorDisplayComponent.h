@@ -35,7 +35,9 @@
 
 #include "dsp/synth/AnalogOscillator.h"
 #include "gui/widget/Shadow.h"
+#include "utility/RepaintTimer.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -46,7 +48,7 @@ namespace component {
 // TODO: Make this use the new display system
 class OscillatorDisplayComponent
   : public juce::Component
-  , public juce::Timer
+  , public dmt::utility::RepaintTimer
   , public dmt::Scaleable<OscillatorDisplayComponent>
 {
   using Shadow = dmt::gui::widget::Shadow;
@@ -66,52 +68,95 @@ class OscillatorDisplayComponent
   const float& outerShadowRadius = Settings::outerShadowRadius;
   const float& innerShadowRadius = Settings::innerShadowRadius;
 
+  //============================================================================
+  // The parameters that shape the waveform, in the order they are applied
+  static constexpr std::array<const char*, 6> parameterIds = {
+    "osc1WaveformType", "osc1DistortionType", "osc1DistortionSymmetry",
+    "osc1WaveformBend", "osc1WaveformPwm",    "osc1WaveformSync"
+  };
+
 public:
   //============================================================================
   OscillatorDisplayComponent(juce::AudioProcessorValueTreeState& apvts)
-    : apvts(apvts)
+    : dmt::utility::RepaintTimer(static_cast<juce::Component&>(*this))
+    , apvts(apvts)
   {
-    TRACER("OscillatorDisplayComponent::OscillatorDisplayComponent");
+    GUI_TRACER_COMPONENT(
+      "OscillatorDisplayComponent::OscillatorDisplayComponent");
     osc.setSampleRate((float)resolution + 1.0f);
     osc.setFrequency(1.0f);
-    startTimerHz(60);
+    for (size_t i = 0; i < parameterIds.size(); ++i)
+      parameters[i] = apvts.getRawParameterValue(parameterIds[i]);
+    startRepaintTimer();
   }
   //============================================================================
   void paint(juce::Graphics& g) override
   {
-    TRACER("OscillatorDisplayComponent::paint");
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::paint");
     const auto bounds = this->getLocalBounds().toFloat();
   }
 
 protected:
   //==============================================================================
-  void timerCallback()
+  void repaintTimerCallback() noexcept override
   {
-    TRACER("OscillatorDisplayComponent::timerCallback");
-    if (isParametersChanged()) {
-      this->buildTable();
-      this->repaint();
-    }
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::repaintTimerCallback");
+    this->updateParameters();
+    this->buildTable();
+    this->repaint();
+  }
+
+  bool hasPendingFrame() const noexcept override
+  {
+    return isParametersChanged();
   }
 
   void buildTable()
   {
-    TRACER("OscillatorDisplayComponent::buildTable");
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::buildTable");
     osc.setPhase(0.0f);
     table.initialise(
       [&](std::size_t index) { return (float)osc.getNextSample(); },
       resolution);
   }
 
-  bool isParametersChanged()
+  bool isParametersChanged() const noexcept
+  {
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::isParametersChanged");
+    if (!hasParameterValues)
+      return true;
+    for (size_t i = 0; i < parameterIds.size(); ++i)
+      if (getParameterValue(i) != parameterValues[i])
+        return true;
+    return false;
+  }
+
+  void updateParameters() noexcept
+  {
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::updateParameters");
+    for (size_t i = 0; i < parameterIds.size(); ++i)
+      parameterValues[i] = getParameterValue(i);
+    hasParameterValues = true;
+
+    osc.setWaveformType(
+      static_cast<dmt::dsp::synth::AnalogWaveform::Type>(parameterValues[0]));
+    osc.setDrive(parameterValues[1]);
+    osc.setBias(parameterValues[2]);
+    osc.setBend(parameterValues[3]);
+    osc.setPwm(parameterValues[4]);
+    osc.setSync(parameterValues[5]);
+  }
+
+  float getParameterValue(const size_t _index) const noexcept
   {
-    TRACER("OscillatorDisplayComponent::isParametersChanged");
+    const auto* parameter = parameters[_index];
+    return parameter != nullptr ? parameter->load() : 0.0f;
   }
 
   //==============================================================================
   juce::Path getPath(juce::Rectangle<float> bounds)
   {
-    TRACER("OscillatorDisplayComponent::getPath");
+    GUI_TRACER_COMPONENT("OscillatorDisplayComponent::getPath");
     bounds.setY(bounds.getY() + (bounds.getHeight() / 10.0f));
     bounds.setHeight(bounds.getHeight() - (bounds.getHeight() / 5.0f));
 
@@ -152,6 +197,9 @@ private:
   AnalogOscillator osc;
   juce::dsp::LookupTable<float> table;
   juce::AudioProcessorValueTreeState& apvts;
+  std::array<std::atomic<float>*, parameterIds.size()> parameters{};
+  std::array<float, parameterIds.size()> parameterValues{};
+  bool hasParameterValues = false;
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OscillatorDisplayComponent)
 };
 } // namespace components
@@ -38,6 +38,7 @@
 #include "utility/HostContextMenu.h"
 #include "utility/Icon.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -100,7 +101,7 @@ public:
     , slider(_type)
     , sliderAttachment(_apvts, _param, slider)
   {
-    TRACER("RotarySliderComponent::RotarySliderComponent");
+    GUI_TRACER_COMPONENT("RotarySliderComponent::RotarySliderComponent");
     slider.addListener(this);
     updateLabel(static_cast<float>(slider.getValue()));
     addAndMakeVisible(slider);
@@ -119,7 +120,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("RotarySliderComponent::resized");
+    GUI_TRACER_COMPONENT("RotarySliderComponent::resized");
     const auto bounds = getLocalBounds();
     const auto padding = rawPadding * this->size;
     auto sliderBounds = bounds;
@@ -147,7 +148,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) override
   {
-    TRACER("RotarySliderComponent::paint");
+    GUI_TRACER_COMPONENT("RotarySliderComponent::paint");
     auto bounds = getLocalBounds();
     _g.setColour(juce::Colours::green);
     if (Settings::debugBounds) {
@@ -169,7 +170,7 @@ public:
    */
   inline void sliderValueChanged(juce::Slider* /*_slider*/) override
   {
-    TRACER("RotarySliderComponent::sliderValueChanged");
+    GUI_TRACER_COMPONENT("RotarySliderComponent::sliderValueChanged");
     updateLabel(static_cast<float>(slider.getValue()));
   }
 
@@ -184,7 +185,7 @@ public:
    */
   inline void setSizeAndCentre(juce::Point<int> _centrePoint) noexcept
   {
-    TRACER("RotarySliderComponent::setSizeAndCentre");
+    GUI_TRACER_COMPONENT("RotarySliderComponent::setSizeAndCentre");
     const int width = static_cast<int>(baseWidth * this->size);
     const int height = static_cast<int>(baseHeight * this->size);
     setSize(width, height);
@@ -39,6 +39,7 @@
 #include "dmt/gui/widget/ValueEditorList.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -85,7 +86,7 @@ public:
                         })
 
   {
-    TRACER("SettingsEditor::SettingsEditor");
+    GUI_TRACER_COMPONENT("SettingsEditor::SettingsEditor");
     addAndMakeVisible(searchEditor);
     addAndMakeVisible(categoryViewport);
     addAndMakeVisible(editorViewport);
@@ -102,12 +103,12 @@ public:
 
   void paint(juce::Graphics& /*_g*/) override
   {
-    TRACER("SettingsEditor::paint");
+    GUI_TRACER_COMPONENT("SettingsEditor::paint");
   }
 
   void resized() override
   {
-    TRACER("SettingsEditor::resized");
+    GUI_TRACER_COMPONENT("SettingsEditor::resized");
     auto bounds = getLocalBounds();
 
     // Set bounds for the search editor
@@ -129,7 +130,7 @@ public:
 
   void onCategorySelectedCallback(TreeAdapter::Category& category)
   {
-    TRACER("SettingsEditor::onCategorySelectedCallback");
+    GUI_TRACER_COMPONENT("SettingsEditor::onCategorySelectedCallback");
     std::cout << "Selected category: " << category.name << std::endl;
     valueEditorList.setCategory(category);
     valueEditorList.setOptimalSize(editorViewport.getWidth());
@@ -139,7 +140,7 @@ protected:
   template<typename ComponentType>
   void layoutViewport(Viewport& viewport, ComponentType& content)
   {
-    TRACER("SettingsEditor::layoutViewport");
+    GUI_TRACER_COMPONENT("SettingsEditor::layoutViewport");
     const int optimalWidth =
       viewport.isVerticalScrollBarShown()
         ? viewport.getWidth() - viewport.getScrollBarThickness()
@@ -149,7 +150,7 @@ protected:
 
   void setScrollbarThicknesses()
   {
-    TRACER("SettingsEditor::setScrollbarThicknesses");
+    GUI_TRACER_COMPONENT("SettingsEditor::setScrollbarThicknesses");
     const int scrollBarThickness =
       static_cast<int>(rawScrollBarThickness * size);
     categoryViewport.setScrollBarThickness(scrollBarThickness);
@@ -158,7 +159,7 @@ protected:
 
   void setScrollBarColour()
   {
-    TRACER("SettingsEditor::setScrollBarColour");
+    GUI_TRACER_COMPONENT("SettingsEditor::setScrollBarColour");
     categoryViewport.getVerticalScrollBar().setColour(
       juce::ScrollBar::ColourIds::thumbColourId, scrollBarColour);
     editorViewport.getVerticalScrollBar().setColour(
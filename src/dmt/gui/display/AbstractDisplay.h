@@ -35,6 +35,7 @@
 #include "gui/widget/Shadow.h"
 #include "utility/RepaintTimer.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -53,6 +54,12 @@ namespace display {
  * shadow rendering, border drawing, and periodic repainting. Subclasses must
  * implement extendResized, paintDisplay, and prepareNextFrame for their own
  * drawing and layout logic.
+ *
+ * The background, the border and everything a subclass draws in
+ * paintStaticLayer are rendered once into cached images at physical
+ * resolution. A frame only blits these layers around the live content of
+ * paintDisplay. The cache is dropped on every resize, which also covers theme
+ * and size changes, and whenever the display scale changes.
  */
 class AbstractDisplay
   : public juce::Component
@@ -96,7 +103,8 @@ public:
    */
   inline explicit AbstractDisplay(
     /*juce::AudioProcessorValueTreeState& _apvts*/) noexcept
-    : outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
+    : dmt::utility::RepaintTimer(static_cast<juce::Component&>(*this))
+    , outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
     , innerShadow(drawInnerShadow, innerShadowColour, innerShadowRadius, true)
   {
     this->startRepaintTimer();
@@ -112,42 +120,31 @@ public:
    * @param _g The graphics context.
    *
    * @details
-   * Handles all background and border drawing, then delegates to paintDisplay
-   * for custom content. Calls prepareNextFrame at the end of each paint.
+   * Blits the cached background layer, delegates to paintDisplay for the live
+   * content and blits the cached border on top. The layers are rendered again
+   * if they were invalidated or the display scale changed. Calls
+   * prepareNextFrame at the end of each paint.
    * This method is final and cannot be overridden by subclasses.
    */
   inline void paint(juce::Graphics& _g) override final
   {
-    // Precalculation
-    const auto borderStrength = rawBorderStrength * size;
-    const auto cornerSize = rawCornerSize * size;
-    const float outerCornerSize = cornerSize;
-    const float innerCornerSize = std::clamp(
-      outerCornerSize - (borderStrength * 0.5f), 0.0f, outerCornerSize);
+    GUI_TRACER_BLOCK("AbstractDisplay::paint");
 
-    // Draw background if border is disabled
-    if (!drawBorder) {
-      _g.setColour(backgroundColour);
-      _g.fillRoundedRectangle(outerBounds.toFloat(), outerCornerSize);
-    }
+    const float currentScale = scale;
+    if (backgroundLayer.isNull() ||
+        !juce::approximatelyEqual(layerScale, currentScale)) [[unlikely]]
+      renderStaticLayers(currentScale);
+
+    const auto bounds = getLocalBounds().toFloat();
+    if (backgroundLayer.isValid())
+      _g.drawImage(backgroundLayer, bounds);
 
-    // Draw background and border if border is enabled
-    if (drawBorder) {
-      _g.setColour(borderColour);
-      _g.fillRoundedRectangle(outerBounds.toFloat(), outerCornerSize);
-      _g.setColour(backgroundColour);
-      _g.fillRoundedRectangle(innerBounds.toFloat(), innerCornerSize);
-    }
     // Draw display
     paintDisplay(_g, innerBounds);
 
-    // We need to draw the border again because drawing it once didn't cut it
-    if (drawBorder) {
-      _g.setColour(borderColour);
-      const auto borderBounds = outerBounds.reduced(borderStrength / 2.0f);
-      _g.drawRoundedRectangle(
-        borderBounds.toFloat(), outerCornerSize, borderStrength);
-    }
+    // The border is drawn again to cut off whatever the display drew over it
+    if (borderLayer.isValid())
+      _g.drawImage(borderLayer, bounds);
 
     // Prepare next frame
     prepareNextFrame();
@@ -163,7 +160,7 @@ public:
    */
   inline void resized() override final
   {
-    TRACER("DisfluxDisplay::resized");
+    GUI_TRACER_COMPONENT("DisfluxDisplay::resized");
 
     const auto bounds = getLocalBounds();
     const auto borderStrength = rawBorderStrength * size;
@@ -190,6 +187,9 @@ public:
 
     // Call the childs extendResized method
     extendResized(drawBorder ? innerBounds : outerBounds);
+
+    // Theme and size changes end up here as well
+    invalidateStaticLayers();
   }
 
 protected:
@@ -220,6 +220,38 @@ protected:
     juce::Graphics& _g,
     const juce::Rectangle<int>& _displayBounds) noexcept = 0;
 
+  //==============================================================================
+  /**
+   * @brief Paints the static parts of the display content.
+   *
+   * @param _g The graphics context of the cached background layer.
+   * @param _displayBounds The bounds of the display area.
+   *
+   * @details
+   * Subclasses can override this to draw anything that doesn't change from
+   * frame to frame, like a grid. It is drawn on top of the background into a
+   * cached image, and only called again after invalidateStaticLayers().
+   */
+  virtual void paintStaticLayer(
+    juce::Graphics& /*_g*/,
+    const juce::Rectangle<int>& /*_displayBounds*/) noexcept
+  {
+  }
+
+  //==============================================================================
+  /**
+   * @brief Drops the cached background and border layers.
+   *
+   * @details
+   * They are rendered again on the next paint. Called on every resize,
+   * subclasses only need it if their static layer changes otherwise.
+   */
+  inline void invalidateStaticLayers() noexcept
+  {
+    backgroundLayer = juce::Image();
+    borderLayer = juce::Image();
+  }
+
   //==============================================================================
   /**
    * @brief Prepares the next frame for display.
@@ -243,6 +275,65 @@ private:
     this->repaint();
   }
 
+  //==============================================================================
+  /**
+   * @brief Renders the background and border layers at physical resolution.
+   *
+   * @param _scale The display scale to render the layers at.
+   */
+  inline void renderStaticLayers(const float _scale) noexcept
+  {
+    GUI_TRACER_COMPONENT("AbstractDisplay::renderStaticLayers");
+    layerScale = _scale;
+
+    const int width = juce::roundToInt(static_cast<float>(getWidth()) * _scale);
+    const int height =
+      juce::roundToInt(static_cast<float>(getHeight()) * _scale);
+    if (width <= 0 || height <= 0)
+      return;
+
+    // Precalculation
+    const auto borderStrength = rawBorderStrength * size;
+    const auto cornerSize = rawCornerSize * size;
+    const float outerCornerSize = cornerSize;
+    const float innerCornerSize = std::clamp(
+      outerCornerSize - (borderStrength * 0.5f), 0.0f, outerCornerSize);
+    const auto transform = juce::AffineTransform::scale(_scale);
+
+    backgroundLayer = juce::Image(juce::Image::ARGB, width, height, true);
+    {
+      juce::Graphics g(backgroundLayer);
+      g.addTransform(transform);
+
+      // Draw background if border is disabled
+      if (!drawBorder) {
+        g.setColour(backgroundColour);
+        g.fillRoundedRectangle(outerBounds.toFloat(), outerCornerSize);
+      }
+
+      // Draw background and border if border is enabled
+      if (drawBorder) {
+        g.setColour(borderColour);
+        g.fillRoundedRectangle(outerBounds.toFloat(), outerCornerSize);
+        g.setColour(backgroundColour);
+        g.fillRoundedRectangle(innerBounds.toFloat(), innerCornerSize);
+      }
+
+      paintStaticLayer(g, innerBounds);
+    }
+
+    if (!drawBorder)
+      return;
+
+    borderLayer = juce::Image(juce::Image::ARGB, width, height, true);
+    juce::Graphics g(borderLayer);
+    g.addTransform(transform);
+    g.setColour(borderColour);
+    const auto borderBounds = outerBounds.reduced(borderStrength / 2.0f);
+    g.drawRoundedRectangle(
+      borderBounds.toFloat(), outerCornerSize, borderStrength);
+  }
+
   //==============================================================================
   // Members initialized in the initializer list
   Shadow outerShadow =
@@ -254,6 +345,9 @@ private:
   // Other members
   juce::Rectangle<int> innerBounds;
   juce::Rectangle<int> outerBounds;
+  juce::Image backgroundLayer;
+  juce::Image borderLayer;
+  float layerScale = 0.0f;
 
   //==============================================================================
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AbstractDisplay)
@@ -29,7 +29,7 @@
 
 //==============================================================================
 
-#include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "gui/display/OscilloscopeDisplay.h"
 #include <JuceHeader.h>
 
@@ -50,13 +50,14 @@ class alignas(64) DisfluxDisplay
   : public dmt::gui::display::OscilloscopeDisplay<float>
 {
 public:
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<float>;
-  DisfluxDisplay(FifoAudioBuffer& _fifoBuffer,
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<float, int16_t>;
+  DisfluxDisplay(BroadcastAudioBuffer& _broadcastBuffer,
                  AudioProcessorValueTreeState& _apvts)
     : OscilloscopeDisplay(
-        _fifoBuffer, // The data buffer
-        _apvts,      // The processers value tree state
-        true)        // This tells the display to not listen to the apvts
+        _broadcastBuffer, // The data buffer
+        _apvts,           // The processers value tree state
+        true)             // This tells the display to not listen to the apvts
   {
   }
 
@@ -31,13 +31,15 @@
 
 //==============================================================================
 
-#include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "dsp/data/RingAudioBuffer.h"
 #include "gui/display/AbstractDisplay.h"
 #include "gui/widget/Oscilloscope.h"
 #include "gui/widget/Shadow.h"
+#include "utility/RenderScheduler.h"
 #include "utility/RepaintTimer.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -54,12 +56,24 @@ class OscilloscopeDisplay
 {
   using Oscilloscope = dmt::gui::widget::Oscilloscope<SampleType>;
   using RingAudioBuffer = dmt::dsp::data::RingAudioBuffer<SampleType>;
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<SampleType>;
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<SampleType, int16_t>;
+  using BroadcastReader = typename BroadcastAudioBuffer::Reader;
   using Shadow = dmt::gui::widget::Shadow;
+  using RenderScheduler = dmt::utility::RenderScheduler;
   using Colour = juce::Colour;
   using Settings = dmt::Settings;
   using DisplaySettings = dmt::Settings::Display;
 
+  // About 20 seconds at 48kHz, enough to fill the display at maximum zoom
+  constexpr static int PYRAMID_SIZE = 1 << 20;
+
+  // Minimum number of input samples per pixel for every decimated sample pair
+  constexpr static float SAMPLES_PER_PIXEL_PER_DECIMATION = 4.0f;
+
+  // Render resolutions are rounded down to multiples of this step
+  constexpr static float RESOLUTION_STEP = 0.25f;
+
   //==============================================================================
   // General
   const Colour& backgroundColour = DisplaySettings::backgroundColour;
@@ -78,14 +92,16 @@ class OscilloscopeDisplay
   const Colour& innerShadowColour = DisplaySettings::innerShadowColour;
   const float& outerShadowRadius = DisplaySettings::outerShadowRadius;
   const float& innerShadowRadius = DisplaySettings::innerShadowRadius;
+  // Rendering
+  const int& pixelBudget = Settings::Oscilloscope::pixelBudget;
 
 public:
   //==============================================================================
-  OscilloscopeDisplay(FifoAudioBuffer& _fifoBuffer,
+  OscilloscopeDisplay(BroadcastAudioBuffer& _broadcastBuffer,
                       AudioProcessorValueTreeState& _apvts,
                       bool _useDefaultSettings = false)
-    : ringBuffer(2, 4096)
-    , fifoBuffer(_fifoBuffer)
+    : ringBuffer(2, 4096, PYRAMID_SIZE)
+    , reader(_broadcastBuffer)
     , leftOscilloscope(ringBuffer, 0, size)
     , rightOscilloscope(ringBuffer, 1, size)
     , useDefaultSettings(_useDefaultSettings)
@@ -102,6 +118,8 @@ public:
     }
   }
   //==============================================================================
+  ~OscilloscopeDisplay() override { renderScheduler->cancel(renderJob); }
+  //==============================================================================
   void extendResized(
     const juce::Rectangle<int>& _displayBounds) noexcept override
   {
@@ -115,6 +133,8 @@ public:
 
     leftOscilloscope.setBounds(leftScopeBounds);
     rightOscilloscope.setBounds(rightScopeBounds);
+    updateResolution();
+    redrawPending = true;
 
     // If using default settings, update oscilloscope parameters on resize
     if (useDefaultSettings) {
@@ -128,7 +148,18 @@ public:
     juce::Graphics& g,
     const juce::Rectangle<int>& /*_displayBounds*/) noexcept override
   {
-    TRACER("OscilloscopeDisplay::paintDisplay");
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::paintDisplay");
+
+    // Draw the latest finished frames, no copy or lock involved
+    drawOscilloscope(g, leftOscilloscope);
+    drawOscilloscope(g, rightOscilloscope);
+  }
+  //==============================================================================
+  void paintStaticLayer(
+    juce::Graphics& g,
+    const juce::Rectangle<int>& /*_displayBounds*/) noexcept override
+  {
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::paintStaticLayer");
 
     const auto leftScopeBounds = leftOscilloscope.getBounds().toFloat();
     const auto rightScopeBounds = rightOscilloscope.getBounds().toFloat();
@@ -158,17 +189,60 @@ public:
                         leftScopeBounds.getWidth(),
                         rightScopeBounds.getY(),
                         rightScopeBounds.getHeight());
-
-    // Draw oscilloscope images
-    g.drawImageAt(leftOscilloscope.getImage(),
-                  leftOscilloscope.getBounds().getX(),
-                  leftOscilloscope.getBounds().getY());
-    g.drawImageAt(rightOscilloscope.getImage(),
-                  rightOscilloscope.getBounds().getX(),
-                  rightOscilloscope.getBounds().getY());
   }
 
 protected:
+  //==============================================================================
+  void drawOscilloscope(juce::Graphics& g, Oscilloscope& _oscilloscope) const
+  {
+    const auto& frame = _oscilloscope.getFrame();
+    const auto& image = frame.image;
+    const float x = static_cast<float>(_oscilloscope.getBounds().getX());
+    const float y = static_cast<float>(_oscilloscope.getBounds().getY());
+    const int height = image.getHeight();
+    const int firstWidth = image.getWidth() - frame.writeColumn;
+
+    // Frames are rendered at their own resolution and scaled to the bounds
+    const float pixelScale = 1.0f / _oscilloscope.getResolution();
+    const auto transform = juce::AffineTransform::scale(pixelScale);
+
+    // The circular image starts at the write column and wraps around
+    g.drawImageTransformed(
+      image.getClippedImage({ frame.writeColumn, 0, firstWidth, height }),
+      transform.translated(x, y));
+    if (frame.writeColumn > 0)
+      g.drawImageTransformed(
+        image.getClippedImage({ 0, 0, frame.writeColumn, height }),
+        transform.translated(x + static_cast<float>(firstWidth) * pixelScale,
+                             y));
+  }
+  //==============================================================================
+  void updateResolution() noexcept
+  {
+    // Full physical resolution, unless both scopes exceed the pixel budget
+    const auto leftBounds = leftOscilloscope.getBounds();
+    const auto rightBounds = rightOscilloscope.getBounds();
+    const float area = static_cast<float>(
+      leftBounds.getWidth() * leftBounds.getHeight() +
+      rightBounds.getWidth() * rightBounds.getHeight());
+    if (area <= 0.0f)
+      return;
+
+    const float physicalResolution = std::max(1.0f, static_cast<float>(scale));
+    const float budgetResolution =
+      std::sqrt(static_cast<float>(std::max(pixelBudget, 0)) / area);
+    const float resolution =
+      std::max(1.0f,
+               std::floor(std::min(physicalResolution, budgetResolution) /
+                          RESOLUTION_STEP) *
+                 RESOLUTION_STEP);
+    if (juce::approximatelyEqual(resolution, leftOscilloscope.getResolution()))
+      return;
+
+    leftOscilloscope.setResolution(resolution);
+    rightOscilloscope.setResolution(resolution);
+    redrawPending = true;
+  }
   //==============================================================================
   void drawVerticalLines(juce::Graphics& g,
                          float scopeX,
@@ -208,35 +282,85 @@ protected:
   //==============================================================================
   void prepareNextFrame() noexcept override
   {
-    TRACER("OscilloscopeDisplay::prepareNextFrame");
-    ringBuffer.write(fifoBuffer);
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::prepareNextFrame");
+    // The display scale changes when the window moves to another screen
+    updateResolution();
+
+    // The worker reads the ring buffer while it renders, so it is only fed
+    // between jobs. The samples wait in the broadcast buffer meanwhile.
+    if (renderJob.isPending()) {
+      frameInFlight = true;
+      return;
+    }
+
+    // The frame rendered now is shown on the next paint
+    frameInFlight = hasAudioActivity() || redrawPending.exchange(false);
+
+    ringBuffer.write(reader);
     ringBuffer.equalizeReadPositions();
-    leftOscilloscope.notify();
-    rightOscilloscope.notify();
+    if (ringBuffer.getDecimation() != appliedDecimation) [[unlikely]]
+      updateSamplesPerPixel();
+
+    // Both channels render in one job, hidden displays don't render at all
+    if (frameInFlight && isShowing())
+      renderScheduler->submit(renderJob);
+  }
+  //==============================================================================
+  bool hasPendingFrame() const noexcept override
+  {
+    // Without new samples or settings the scope would show the same frame
+    return frameInFlight || redrawPending.load(std::memory_order_relaxed) ||
+           hasAudioActivity();
+  }
+  //==============================================================================
+  bool hasAudioActivity() const noexcept
+  {
+    // Once a full width of silence is shown, more silence changes nothing
+    const auto visibleValues =
+      static_cast<uint64_t>(leftOscilloscope.getNumVisibleValues());
+    return reader.hasPendingSamples() &&
+           reader.getNumSilentValues() <= visibleValues;
   }
   //==============================================================================
   void setZoom(float _zoom) noexcept
   {
-    TRACER("OscilloscopeDisplay::setZoom");
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::setZoom");
     // Just random math with magic numbers to get a nice feeling zoom
     float zoomModifier = (_zoom + 5) / 105.0f;
     float maxSamplesPerPixel = 900.0f;
     float exponentialModifier = pow(zoomModifier, 4.0f);
-    float samplesPerPixel = 1.0f + maxSamplesPerPixel * exponentialModifier;
-    leftOscilloscope.setRawSamplesPerPixel(samplesPerPixel);
-    rightOscilloscope.setRawSamplesPerPixel(samplesPerPixel);
+    samplesPerPixel = 1.0f + maxSamplesPerPixel * exponentialModifier;
+
+    // Zoomed out far enough, min/max pairs carry everything the scope shows
+    const int decimation = static_cast<int>(
+      samplesPerPixel / SAMPLES_PER_PIXEL_PER_DECIMATION);
+    reader.setDecimation(decimation);
+    updateSamplesPerPixel();
+  }
+  //==============================================================================
+  void updateSamplesPerPixel() noexcept
+  {
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::updateSamplesPerPixel");
+    // Every group of decimated samples arrives as a min/max pair
+    appliedDecimation = ringBuffer.getDecimation();
+    const float valuesPerPixel =
+      appliedDecimation > 1
+        ? samplesPerPixel * 2.0f / static_cast<float>(appliedDecimation)
+        : samplesPerPixel;
+    leftOscilloscope.setRawSamplesPerPixel(valuesPerPixel);
+    rightOscilloscope.setRawSamplesPerPixel(valuesPerPixel);
   }
   //==============================================================================
   void setThickness(float _thickness) noexcept
   {
-    TRACER("OscilloscopeDisplay::setThickness");
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::setThickness");
     leftOscilloscope.setThickness(_thickness);
     rightOscilloscope.setThickness(_thickness);
   }
   //==============================================================================
   void setHeight(float _height) noexcept
   {
-    TRACER("OscilloscopeDisplay::setHeight");
+    GUI_TRACER_COMPONENT("OscilloscopeDisplay::setHeight");
     float amplitude = juce::Decibels::decibelsToGain(_height);
     leftOscilloscope.setAmplitude(amplitude);
     rightOscilloscope.setAmplitude(amplitude);
@@ -253,14 +377,24 @@ protected:
     if (_parameterID == "OscilloscopeGain") {
       setHeight(_newValue);
     }
+    redrawPending = true;
   }
   //==============================================================================
 private:
   RingAudioBuffer ringBuffer;
-  FifoAudioBuffer& fifoBuffer;
+  BroadcastReader reader;
   Oscilloscope leftOscilloscope;
   Oscilloscope rightOscilloscope;
+  juce::SharedResourcePointer<RenderScheduler> renderScheduler;
+  RenderScheduler::Job renderJob{ [this] {
+    leftOscilloscope.renderFrame();
+    rightOscilloscope.renderFrame();
+  } };
   bool useDefaultSettings;
+  float samplesPerPixel = 1.0f;
+  int appliedDecimation = 1;
+  bool frameInFlight = false;
+  std::atomic<bool> redrawPending{ true };
   //==============================================================================
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OscilloscopeDisplay)
@@ -34,6 +34,7 @@
 #include "dmt/gui/component/SettingsEditorComponent.h"
 #include "dmt/gui/display/AbstractDisplay.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -57,7 +58,7 @@ class SettingsEditorDisplay : public dmt::gui::display::AbstractDisplay
 public:
   SettingsEditorDisplay()
   {
-    TRACER("SettingsEditorDisplay::SettingsEditorDisplay");
+    GUI_TRACER_COMPONENT("SettingsEditorDisplay::SettingsEditorDisplay");
     addAndMakeVisible(settingsEditor);
   }
 
@@ -66,7 +67,7 @@ public:
   void extendResized(
     const juce::Rectangle<int>& _displayBounds) noexcept override
   {
-    TRACER("SettingsEditorDisplay::extendResized");
+    GUI_TRACER_COMPONENT("SettingsEditorDisplay::extendResized");
     const auto padding = rawPadding * size;
     auto settingsBounds = _displayBounds.reduced(padding);
     settingsEditor.setBounds(settingsBounds);
@@ -75,7 +76,7 @@ public:
   void paintDisplay(juce::Graphics& /*_g*/,
                     const juce::Rectangle<int>& /*_displayBounds*/) noexcept
   {
-    TRACER("SettingsEditorDisplay::paintDisplay");
+    GUI_TRACER_COMPONENT("SettingsEditorDisplay::paintDisplay");
     if (cachedPadding != rawPadding) {
       cachedPadding = rawPadding;
       resized();
@@ -84,10 +85,16 @@ public:
 
   void prepareNextFrame() noexcept override
   {
-    TRACER("SettingsEditorDisplay::prepareNextFrame");
+    GUI_TRACER_COMPONENT("SettingsEditorDisplay::prepareNextFrame");
     // Implement frame preparation logic here
   }
 
+  //==============================================================================
+  /**
+   * @brief The editor repaints itself, so the display is never animated.
+   */
+  bool hasPendingFrame() const noexcept override { return false; }
+
 private:
   SettingsEditor settingsEditor;
   float cachedPadding = 0.0f;
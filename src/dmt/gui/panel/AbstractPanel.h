@@ -36,6 +36,7 @@
 #include "gui/widget/TriangleButton.h"
 #include "utility/Fonts.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -133,7 +134,7 @@ public:
     , outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
     , innerShadow(drawInnerShadow, outerShadowColour, outerShadowRadius, true)
   {
-    TRACER("AbstractPanel::AbstractPanel");
+    GUI_TRACER_COMPONENT("AbstractPanel::AbstractPanel");
     if (_displayName) {
       addAndMakeVisible(titleLabel);
     }
@@ -155,7 +156,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) noexcept override
   {
-    TRACER("AbstractPanel::paint");
+    GUI_TRACER_COMPONENT("AbstractPanel::paint");
     // Precalculation
     const auto bounds = this->getLocalBounds().toFloat();
     const auto outerBounds = bounds.reduced(margin * size * 0.5f);
@@ -217,7 +218,7 @@ public:
    */
   inline void resized() noexcept override
   {
-    TRACER("AbstractPanel::resized");
+    GUI_TRACER_COMPONENT("AbstractPanel::resized");
     const auto bounds = getLocalBounds();
     const auto outerBounds = bounds.reduced(margin * size * 0.5f);
     const auto innerBounds = outerBounds.reduced(borderStrength * size);
@@ -280,7 +281,7 @@ public:
    */
   virtual inline const juce::String getName() noexcept
   {
-    TRACER("AbstractPanel::getName");
+    GUI_TRACER_COMPONENT("AbstractPanel::getName");
     return "Panel";
   }
 
@@ -297,7 +298,7 @@ public:
   inline void setCallbacks(std::function<void()> _next,
                            std::function<void()> _prev)
   {
-    TRACER("AbstractPanel::setCallbacks");
+    GUI_TRACER_COMPONENT("AbstractPanel::setCallbacks");
     nextCallback = _next;
     prevCallback = _prev;
     addAndMakeVisible(nextButton);
@@ -312,7 +313,7 @@ public:
    */
   inline void next()
   {
-    TRACER("AbstractPanel::next");
+    GUI_TRACER_COMPONENT("AbstractPanel::next");
     nextCallback();
   }
 
@@ -322,7 +323,7 @@ public:
    */
   inline void prev()
   {
-    TRACER("AbstractPanel::prev");
+    GUI_TRACER_COMPONENT("AbstractPanel::prev");
     prevCallback();
   }
 
@@ -338,7 +339,7 @@ public:
    */
   inline void buttonClicked(juce::Button* _button) override
   {
-    TRACER("AbstractPanel::buttonClicked");
+    GUI_TRACER_COMPONENT("AbstractPanel::buttonClicked");
     if (_button == &nextButton) {
       nextCallback();
     } else if (_button == &prevButton) {
@@ -355,7 +356,7 @@ protected:
    */
   [[nodiscard]] inline const Layout getLayout() noexcept
   {
-    TRACER("AbstractPanel::getLayout");
+    GUI_TRACER_COMPONENT("AbstractPanel::getLayout");
     return layout;
   }
 
@@ -370,7 +371,7 @@ protected:
    */
   inline void setLayout(const Layout _layoutToUse) noexcept
   {
-    TRACER("AbstractPanel::setLayout");
+    GUI_TRACER_COMPONENT("AbstractPanel::setLayout");
     const int cols = _layoutToUse.cols;
     const int rows = _layoutToUse.rows;
     const float colSpacing = 1.0f / static_cast<float>(cols + 1);
@@ -411,7 +412,7 @@ protected:
     const int _col,
     const int _row) noexcept
   {
-    TRACER("AbstractPanel::getGridPoint");
+    GUI_TRACER_COMPONENT("AbstractPanel::getGridPoint");
     // assert if col and row are out of bounds
     jassert(_col >= 0 && static_cast<size_t>(_col) < grid.size());
     jassert(_row >= 0 &&
@@ -440,7 +441,7 @@ protected:
    */
   inline void setRawGridOffset(const int _offset) noexcept
   {
-    TRACER("AbstractPanel::setRawGridOffset");
+    GUI_TRACER_COMPONENT("AbstractPanel::setRawGridOffset");
     rawGridOffsetY = _offset;
   }
 
@@ -452,7 +453,7 @@ protected:
    */
   [[nodiscard]] inline const int getRawGridOffset() const noexcept
   {
-    TRACER("AbstractPanel::getRawGridOffset");
+    GUI_TRACER_COMPONENT("AbstractPanel::getRawGridOffset");
     return rawGridOffsetY;
   }
 
@@ -32,6 +32,7 @@
 
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/panel/AbstractPanel.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -77,7 +78,7 @@ public:
                  LinearSliderType::Positive,
                  LinearSliderOrientation::Vertical)
   {
-    TRACER("AnalogGainPanel::AnalogGainPanel");
+    GUI_TRACER_COMPONENT("AnalogGainPanel::AnalogGainPanel");
     setLayout({ 25, 32 });
     addAndMakeVisible(attackSlider);
     addAndMakeVisible(holdSlider);
@@ -87,7 +88,7 @@ public:
 
   void extendResize() noexcept override
   {
-    TRACER("AnalogGainPanel::extendResize");
+    GUI_TRACER_COMPONENT("AnalogGainPanel::extendResize");
     const auto bounds = getLocalBounds();
 
     const int primaryRow = 3;
@@ -35,7 +35,7 @@
 
 //==============================================================================
 
-#include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #if DMT_EXCLUDE_DISFLUX_DISPLAY == 0
@@ -43,6 +43,7 @@
 #endif
 #include "gui/panel/AbstractPanel.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -66,7 +67,8 @@ namespace panel {
 template<typename SampleType>
 class DisfluxPanel : public dmt::gui::panel::AbstractPanel
 {
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<float>;
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<float, int16_t>;
 #if DMT_EXCLUDE_DISFLUX_DISPLAY == 0
   using DisfluxDisplay = dmt::gui::display::DisfluxDisplay;
 #endif
@@ -85,7 +87,7 @@ public:
    * @brief Constructs a DisfluxPanel.
    *
    * @param _apvts The AudioProcessorValueTreeState for parameter binding.
-   * @param _oscilloscopeBuffer The FIFO buffer for oscilloscope display.
+   * @param _oscilloscopeBuffer The broadcast buffer feeding the display.
    *
    * @details
    * Initializes all display and slider components, sets up the grid layout,
@@ -93,7 +95,7 @@ public:
    */
   constexpr inline explicit DisfluxPanel(
     juce::AudioProcessorValueTreeState& _apvts,
-    FifoAudioBuffer& _oscilloscopeBuffer) noexcept
+    BroadcastAudioBuffer& _oscilloscopeBuffer) noexcept
     : AbstractPanel("Oscilloscope", false)
 #if DMT_EXCLUDE_DISFLUX_DISPLAY == 0
     , display(_oscilloscopeBuffer, _apvts)
@@ -125,7 +127,7 @@ public:
                 Unit::Type::DisfluxMix,
                 RotarySliderType::Positive)
   {
-    TRACER("DisfluxPanel::DisfluxPanel");
+    GUI_TRACER_COMPONENT("DisfluxPanel::DisfluxPanel");
     setLayout({ 22, 60 });
 #if DMT_EXCLUDE_DISFLUX_DISPLAY == 0
     addAndMakeVisible(display);
@@ -148,7 +150,7 @@ public:
    */
   inline void extendResize() noexcept override
   {
-    TRACER("DisfluxPanel::extendResize");
+    GUI_TRACER_COMPONENT("DisfluxPanel::extendResize");
     auto bounds = getLocalBounds();
 
     const float padding = rawPadding * size;
@@ -29,12 +29,13 @@
 
 //==============================================================================
 
-#include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/display/DisfluxDisplay.h"
 #include "gui/panel/AbstractPanel.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -58,7 +59,8 @@ namespace panel {
 template<typename SampleType>
 class HeretikDrivePanel : public dmt::gui::panel::AbstractPanel
 {
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<float>;
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<float, int16_t>;
   using DisfluxDisplay = dmt::gui::display::DisfluxDisplay;
   using LinearSlider = dmt::gui::component::LinearSliderComponent;
   using LinearSliderType = dmt::gui::widget::LinearSlider::Type;
@@ -75,7 +77,7 @@ public:
    * @brief Constructs a DisfluxPanel.
    *
    * @param _apvts The AudioProcessorValueTreeState for parameter binding.
-   * @param _oscilloscopeBuffer The FIFO buffer for oscilloscope display.
+   * @param _oscilloscopeBuffer The broadcast buffer feeding the display.
    *
    * @details
    * Initializes all display and slider components, sets up the grid layout,
@@ -83,7 +85,7 @@ public:
    */
   constexpr inline explicit HeretikDrivePanel(
     juce::AudioProcessorValueTreeState& _apvts,
-    FifoAudioBuffer& _oscilloscopeBuffer) noexcept
+    BroadcastAudioBuffer& _oscilloscopeBuffer) noexcept
     : AbstractPanel("Oscilloscope", false)
     , driveTypeSlider(_apvts,
                       juce::String("Type"),
@@ -102,7 +104,7 @@ public:
                  Unit::Type::HeretikDriveBias,
                  RotarySliderType::Bipolar)
   {
-    TRACER("DisfluxPanel::DisfluxPanel");
+    GUI_TRACER_COMPONENT("DisfluxPanel::DisfluxPanel");
     setLayout({ 20, 60 });
 
     addAndMakeVisible(driveTypeSlider);
@@ -121,7 +123,7 @@ public:
    */
   inline void extendResize() noexcept override
   {
-    TRACER("DisfluxPanel::extendResize");
+    GUI_TRACER_COMPONENT("DisfluxPanel::extendResize");
     auto bounds = getLocalBounds();
 
     const int upperRotarySliderRow = 21;
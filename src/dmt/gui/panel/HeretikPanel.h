@@ -30,12 +30,13 @@
 
 //==============================================================================
 
-#include "dsp/data/FifoAudioBuffer.h"
+#include "dsp/data/BroadcastAudioBuffer.h"
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/display/DisfluxDisplay.h"
 #include "gui/panel/AbstractPanel.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -59,7 +60,8 @@ namespace panel {
 template<typename SampleType>
 class HeretikPanel : public dmt::gui::panel::AbstractPanel
 {
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<float>;
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<float, int16_t>;
   using DisfluxDisplay = dmt::gui::display::DisfluxDisplay;
   using LinearSlider = dmt::gui::component::LinearSliderComponent;
   using LinearSliderType = dmt::gui::widget::LinearSlider::Type;
@@ -76,7 +78,7 @@ public:
    * @brief Constructs a DisfluxPanel.
    *
    * @param _apvts The AudioProcessorValueTreeState for parameter binding.
-   * @param _oscilloscopeBuffer The FIFO buffer for oscilloscope display.
+   * @param _oscilloscopeBuffer The broadcast buffer feeding the display.
    *
    * @details
    * Initializes all display and slider components, sets up the grid layout,
@@ -84,7 +86,7 @@ public:
    */
   constexpr inline explicit HeretikPanel(
     juce::AudioProcessorValueTreeState& _apvts,
-    FifoAudioBuffer& _oscilloscopeBuffer) noexcept
+    BroadcastAudioBuffer& _oscilloscopeBuffer) noexcept
     : AbstractPanel("Oscilloscope", false)
     , display(_oscilloscopeBuffer, _apvts)
     , driveSlider(_apvts,
@@ -114,7 +116,7 @@ public:
                 Unit::Type::HeretikMix,
                 RotarySliderType::Positive)
   {
-    TRACER("DisfluxPanel::DisfluxPanel");
+    GUI_TRACER_COMPONENT("DisfluxPanel::DisfluxPanel");
     setLayout({ 60, 60 });
 
     addAndMakeVisible(display);
@@ -136,7 +138,7 @@ public:
    */
   inline void extendResize() noexcept override
   {
-    TRACER("DisfluxPanel::extendResize");
+    GUI_TRACER_COMPONENT("DisfluxPanel::extendResize");
     auto bounds = getLocalBounds();
 
     const float padding = rawPadding * size;
@@ -33,6 +33,7 @@
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/panel/AbstractPanel.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -66,7 +67,7 @@ public:
                 Unit::Type::Pan,
                 LinearSliderType::Bipolar)
   {
-    TRACER("OscSendPanel::OscSendPanel");
+    GUI_TRACER_COMPONENT("OscSendPanel::OscSendPanel");
     setLayout({ 3, 32 });
     addAndMakeVisible(gainSlider);
     addAndMakeVisible(panSlider);
@@ -74,7 +75,7 @@ public:
 
   void extendResize() noexcept override
   {
-    TRACER("OscSendPanel::extendResize");
+    GUI_TRACER_COMPONENT("OscSendPanel::extendResize");
     auto bounds = getLocalBounds();
     auto gainSliderPoint = this->getGridPoint(bounds, 2, 10);
     gainSlider.setSizeAndCentre(gainSliderPoint);
@@ -46,7 +46,8 @@ namespace panel {
 template<typename SampleType>
 class OscilloscopePanel : public dmt::gui::panel::AbstractPanel
 {
-  using FifoAudioBuffer = dmt::dsp::data::FifoAudioBuffer<SampleType>;
+  using BroadcastAudioBuffer =
+    dmt::dsp::data::BroadcastAudioBuffer<SampleType, int16_t>;
   using OscilloscopeDisplay =
     dmt::gui::display::OscilloscopeDisplay<SampleType>;
 
@@ -61,10 +62,10 @@ class OscilloscopePanel : public dmt::gui::panel::AbstractPanel
 
 public:
   //============================================================================
-  OscilloscopePanel(FifoAudioBuffer& fifoBuffer,
+  OscilloscopePanel(BroadcastAudioBuffer& broadcastBuffer,
                     juce::AudioProcessorValueTreeState& apvts)
     : AbstractPanel("Oscilloscope", false)
-    , oscilloscopeComponent(fifoBuffer, apvts)
+    , oscilloscopeComponent(broadcastBuffer, apvts)
     , zoomSlider(apvts,
                  juce::String("Zoom"),
                  juce::String("OscilloscopeZoom"),
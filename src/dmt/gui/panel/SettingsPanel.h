@@ -19,6 +19,7 @@
  *
  * Description:
  * SettingsPanel is a GUI component that provides controls for global settings.
+ * It also shows the processBlock load of the plugin instance.
  *
  * Authors:
  * Lunix-420 (Primary Author)
@@ -33,7 +34,11 @@
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/display/SettingsEditorDisplay.h"
 #include "gui/panel/AbstractPanel.h"
+#include "gui/widget/Label.h"
+#include "utility/Fonts.h"
+#include "utility/LoadMeter.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -45,7 +50,9 @@ namespace panel {
 
 //==============================================================================
 
-class SettingsPanel : public dmt::gui::panel::AbstractPanel
+class SettingsPanel
+  : public dmt::gui::panel::AbstractPanel
+  , private juce::Timer
 {
   using RotarySliderComponent = dmt::gui::component::RotarySliderComponent;
   using LinearSliderComponent = dmt::gui::component::LinearSliderComponent;
@@ -54,24 +61,39 @@ class SettingsPanel : public dmt::gui::panel::AbstractPanel
   using Unit = dmt::utility::Unit;
   using SettingsEditorDisplay = dmt::gui::display::SettingsEditorDisplay;
   using Settings = dmt::Settings;
+  using SettingsEditorSettings = dmt::Settings::SettingsEditor;
+  using Label = dmt::gui::widget::Label;
+  using Fonts = dmt::utility::Fonts;
+  using LoadMeter = dmt::utility::LoadMeter;
+
+  constexpr static int LOAD_REFRESH_RATE = 4;
 
   //==============================================================================
   const float& rawPadding = Settings::Panel::padding;
+  const float& rawFontSize = SettingsEditorSettings::fontSize;
+  const juce::Colour& fontColour = SettingsEditorSettings::fontColour;
 
 public:
-  SettingsPanel(/*juce::AudioProcessorValueTreeState& apvts*/)
+  SettingsPanel(const LoadMeter& _loadMeter)
     : AbstractPanel("Settings", false)
+    , loadMeter(_loadMeter)
+    , loadLabel("",
+                fonts.medium,
+                rawFontSize,
+                fontColour,
+                juce::Justification::centredLeft)
   {
-    TRACER("SettingsPanel::SettingsPanel");
+    GUI_TRACER_COMPONENT("SettingsPanel::SettingsPanel");
     setLayout({ 22, 60 });
     addAndMakeVisible(settingsEditor);
+    addAndMakeVisible(loadLabel);
   }
 
-  ~SettingsPanel() override = default;
+  ~SettingsPanel() override { stopTimer(); }
 
   void extendResize() noexcept override
   {
-    TRACER("SettingsPanel::extendResize");
+    GUI_TRACER_COMPONENT("SettingsPanel::extendResize");
     auto bounds = getLocalBounds();
 
     const float padding = rawPadding * size;
@@ -83,11 +105,46 @@ public:
     editorBounds.removeFromBottom(editorBottomPadding * size);
     editorBounds.removeFromLeft(editorHorizontalPadding * size);
     editorBounds.removeFromRight(editorHorizontalPadding * size);
+    const float loadHeight = rawFontSize * 1.5f * size;
+    loadLabel.setBounds(editorBounds.removeFromBottom(loadHeight));
     settingsEditor.setBounds(editorBounds);
   }
 
+  void visibilityChanged() override
+  {
+    GUI_TRACER_COMPONENT("SettingsPanel::visibilityChanged");
+    if (isVisible()) {
+      updateLoadLabel();
+      startTimerHz(LOAD_REFRESH_RATE);
+    } else {
+      stopTimer();
+    }
+  }
+
 private:
+  //==============================================================================
+  void timerCallback() override { updateLoadLabel(); }
+
+  //==============================================================================
+  void updateLoadLabel() noexcept
+  {
+    GUI_TRACER_COMPONENT("SettingsPanel::updateLoadLabel");
+    const auto statistics = loadMeter.getStatistics();
+    const auto percent = [](const float _load) {
+      return juce::String(_load * 100.0f, 1) + " %";
+    };
+    loadLabel.setText("DSP Load: " + percent(statistics.lastLoad) +
+                      "   Peak: " + percent(statistics.peakLoad) +
+                      "   P99: " + percent(statistics.p99Load) +
+                      "   Overruns: " + juce::String(statistics.numOverruns));
+    loadLabel.repaint();
+  }
+
+  //==============================================================================
+  const LoadMeter& loadMeter;
+  Fonts fonts;
   SettingsEditorDisplay settingsEditor;
+  Label loadLabel;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SettingsPanel)
 };
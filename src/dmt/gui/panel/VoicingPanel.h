@@ -33,6 +33,7 @@
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/panel/AbstractPanel.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -108,7 +109,7 @@ public:
                   Unit::Type::Degree,
                   LinearSliderType::Positive)
   {
-    TRACER("VoicingPanel::VoicingPanel");
+    GUI_TRACER_COMPONENT("VoicingPanel::VoicingPanel");
     setLayout({ 31, 32 });
 
     addAndMakeVisible(osctaveSlider);
@@ -127,7 +128,7 @@ public:
   }
   void extendResize() noexcept override
   {
-    TRACER("VoicingPanel::extendResize");
+    GUI_TRACER_COMPONENT("VoicingPanel::extendResize");
     const auto bounds = getLocalBounds();
     const int rotarySliderRow = 10;
     const int linearSliderRow = 26;
@@ -33,6 +33,7 @@
 #include "gui/component/LinearSliderComponent.h"
 #include "gui/component/RotarySliderComponent.h"
 #include "gui/panel/AbstractPanel.h"
+#include "utility/Tracer.h"
 #include "utility/Unit.h"
 #include <JuceHeader.h>
 
@@ -77,7 +78,7 @@ public:
                   juce::String("osc1DistortionCrush"),
                   Unit::Type::Bitdepth)
   {
-    TRACER("WaveformDistortionPanel::WaveformDistortionPanel");
+    GUI_TRACER_COMPONENT("WaveformDistortionPanel::WaveformDistortionPanel");
     setLayout({ 17, 32 });
     addAndMakeVisible(typeSlider);
     addAndMakeVisible(driveSlider);
@@ -87,7 +88,7 @@ public:
   }
   void extendResize() noexcept override
   {
-    TRACER("WaveformDistortionPanel::extendResize");
+    GUI_TRACER_COMPONENT("WaveformDistortionPanel::extendResize");
     const auto bounds = getLocalBounds();
     const int rotarySliderRow = 10;
     const int linearSliderRow = 26;
@@ -35,6 +35,7 @@
 #include "utility/Icon.h"
 #include "utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -119,7 +120,7 @@ public:
     , outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
     , innerShadow(drawInnerShadow, innerShadowColour, innerShadowRadius, true)
   {
-    TRACER("AbstractButton::AbstractButton");
+    GUI_TRACER_COMPONENT("AbstractButton::AbstractButton");
     icon = dmt::icons::getIcon(_iconName);
 
     if (shouldDrawShadows) {
@@ -168,7 +169,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("AbstractButton::resized");
+    GUI_TRACER_COMPONENT("AbstractButton::resized");
     auto bounds = getLocalBounds();
     const auto buttonPadding = rawButtonPadding * size;
     const auto innerBounds = bounds.reduced(buttonPadding);
@@ -201,7 +202,7 @@ public:
    */
   [[nodiscard]] inline String getTooltip() override
   {
-    TRACER("AbstractButton::getTooltip");
+    GUI_TRACER_COMPONENT("AbstractButton::getTooltip");
     return tooltip;
   }
 
@@ -214,7 +215,7 @@ public:
    */
   inline void setPassiveState()
   {
-    TRACER("AbstractButton::setPassiveState");
+    GUI_TRACER_COMPONENT("AbstractButton::setPassiveState");
     if (shouldDrawBackground) {
       backgroundImageComponent.setVisible(true);
       hoverBackgroundImageComponent.setVisible(false);
@@ -233,7 +234,7 @@ public:
    */
   inline void setHoverState()
   {
-    TRACER("AbstractButton::setHoverState");
+    GUI_TRACER_COMPONENT("AbstractButton::setHoverState");
     if (shouldDrawBackground) {
       backgroundImageComponent.setVisible(false);
       hoverBackgroundImageComponent.setVisible(true);
@@ -252,7 +253,7 @@ public:
    */
   inline void setClickedState()
   {
-    TRACER("AbstractButton::setClickedState");
+    GUI_TRACER_COMPONENT("AbstractButton::setClickedState");
     if (shouldDrawBackground) {
       backgroundImageComponent.setVisible(false);
       hoverBackgroundImageComponent.setVisible(false);
@@ -277,7 +278,7 @@ public:
                           bool /*_isMouseOverButton*/,
                           bool /*_isButtonDown*/) override
   {
-    TRACER("AbstractButton::paintButton");
+    GUI_TRACER_COMPONENT("AbstractButton::paintButton");
   }
 
 private:
@@ -295,7 +296,7 @@ private:
   inline void setShadowBounds(const juce::Rectangle<int>& _innerBounds,
                               float _cornerRadius)
   {
-    TRACER("AbstractButton::setShadowBounds");
+    GUI_TRACER_COMPONENT("AbstractButton::setShadowBounds");
     if (!shouldDrawShadows)
       return;
 
@@ -323,7 +324,7 @@ private:
    */
   inline void setBackgroundBounds(const juce::Rectangle<int>& _innerBounds)
   {
-    TRACER("AbstractButton::setBackgroundBounds");
+    GUI_TRACER_COMPONENT("AbstractButton::setBackgroundBounds");
     if (!shouldDrawBackground)
       return;
 
@@ -353,7 +354,7 @@ private:
    */
   inline void setIconBounds(const juce::Rectangle<int>& _innerBounds)
   {
-    TRACER("AbstractButton::setIconBounds");
+    GUI_TRACER_COMPONENT("AbstractButton::setIconBounds");
     const auto specificSvgPadding = rawSpecificSvgPadding * size;
     const auto globalSvgPadding = 2.5f * size;
     const auto svgPadding = specificSvgPadding + globalSvgPadding;
@@ -384,7 +385,7 @@ private:
    */
   inline void drawBackground()
   {
-    TRACER("AbstractButton::drawBackground");
+    GUI_TRACER_COMPONENT("AbstractButton::drawBackground");
     if (!shouldDrawBackground)
       return;
 
@@ -429,7 +430,7 @@ private:
    */
   inline void drawIcon()
   {
-    TRACER("AbstractButton::drawIcon");
+    GUI_TRACER_COMPONENT("AbstractButton::drawIcon");
     if (icon != nullptr) {
       // Draw normal icon at high res, then scale down for display
       juce::Graphics iconGraphics(iconImage);
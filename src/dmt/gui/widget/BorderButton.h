@@ -34,6 +34,7 @@
 #include "utility/RepaintTimer.h"
 #include "utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -89,10 +90,11 @@ public:
    */
   BorderButton() noexcept
     : juce::Button("BorderButton")
+    , dmt::utility::RepaintTimer(static_cast<juce::Component&>(*this))
     , currentOpacity(MIN_OPACITY) // Start with semi-transparency
     , isHovered(false)
   {
-    TRACER("BorderButton::BorderButton");
+    GUI_TRACER_COMPONENT("BorderButton::BorderButton");
     addMouseListener(this, true);
     startRepaintTimer(); // Start the timer in the constructor
   }
@@ -112,7 +114,7 @@ public:
    */
   void resized() override
   {
-    TRACER("BorderButton::resized");
+    GUI_TRACER_COMPONENT("BorderButton::resized");
     updateCachedImage();
   }
 
@@ -131,7 +133,7 @@ public:
                           bool /*_isMouseOverButton*/,
                           bool /*_isButtonDown*/) override
   {
-    TRACER("BorderButton::paintButton");
+    GUI_TRACER_COMPONENT("BorderButton::paintButton");
     _g.setOpacity(currentOpacity);
     // Draw the cached image scaled to fit the button area
     _g.drawImage(cachedImage, getLocalBounds().toFloat());
@@ -147,7 +149,7 @@ public:
    */
   inline void mouseEnter(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("BorderButton::mouseEnter");
+    GUI_TRACER_COMPONENT("BorderButton::mouseEnter");
     isHovered = true;
     currentOpacity = MAX_OPACITY;
     repaint();
@@ -163,7 +165,7 @@ public:
    */
   inline void mouseExit(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("BorderButton::mouseExit");
+    GUI_TRACER_COMPONENT("BorderButton::mouseExit");
     isHovered = false;
   }
 
@@ -176,7 +178,7 @@ public:
    */
   inline void setOpacityToMax() noexcept
   {
-    TRACER("BorderButton::setOpacityToMax");
+    GUI_TRACER_COMPONENT("BorderButton::setOpacityToMax");
     currentOpacity = MAX_OPACITY;
     repaint();
   }
@@ -189,7 +191,7 @@ public:
    */
   inline void setButtonCallback(ButtonCallback _callback) noexcept
   {
-    TRACER("BorderButton::setButtonCallback");
+    GUI_TRACER_COMPONENT("BorderButton::setButtonCallback");
     buttonCallback = std::move(_callback);
   }
 
@@ -201,7 +203,7 @@ public:
    */
   inline void clicked() override
   {
-    TRACER("BorderButton::clicked");
+    GUI_TRACER_COMPONENT("BorderButton::clicked");
     if (buttonCallback) {
       buttonCallback();
     }
@@ -217,7 +219,7 @@ protected:
    */
   void updateCachedImage()
   {
-    TRACER("BorderButton::updateCachedImage");
+    GUI_TRACER_COMPONENT("BorderButton::updateCachedImage");
     const auto width = getWidth();
     const auto height = getHeight();
 
@@ -259,7 +261,7 @@ protected:
    */
   void repaintTimerCallback() noexcept override
   {
-    TRACER("BorderButton::repaintTimerCallback");
+    GUI_TRACER_COMPONENT("BorderButton::repaintTimerCallback");
     const float fadeSpeed =
       RAW_FADE_SPEED / static_cast<float>(Settings::framerate);
 
@@ -269,6 +271,15 @@ protected:
     }
   }
 
+  //==============================================================================
+  /**
+   * @brief Checks whether the button is still fading out.
+   */
+  [[nodiscard]] bool hasPendingFrame() const noexcept override
+  {
+    return !isHovered && currentOpacity > MIN_OPACITY;
+  }
+
 private:
   //==============================================================================
   // Members initialized in the initializer list
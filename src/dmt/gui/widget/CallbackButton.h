@@ -34,6 +34,7 @@
 #include "gui/widget/Shadow.h"
 #include "utility/Icon.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -96,7 +97,7 @@ public:
                      _shouldDrawShadow,
                      _alternativeIconHover)
   {
-    TRACER("CallbackButton::CallbackButton");
+    GUI_TRACER_COMPONENT("CallbackButton::CallbackButton");
     setPassiveState(); // Set initial state for consistent appearance
   }
 
@@ -120,7 +121,7 @@ public:
    */
   inline void mouseEnter(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("CallbackButton::mouseEnter");
+    GUI_TRACER_COMPONENT("CallbackButton::mouseEnter");
     if (isEnabled()) {
       setHoverState();
     }
@@ -139,7 +140,7 @@ public:
    */
   inline void mouseExit(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("CallbackButton::mouseExit");
+    GUI_TRACER_COMPONENT("CallbackButton::mouseExit");
     if (isEnabled()) {
       setPassiveState();
     }
@@ -158,7 +159,7 @@ public:
    */
   inline void mouseDown(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("CallbackButton::mouseDown");
+    GUI_TRACER_COMPONENT("CallbackButton::mouseDown");
     if (isEnabled()) {
       setClickedState();
     }
@@ -179,7 +180,7 @@ public:
    */
   inline void mouseUp(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("CallbackButton::mouseUp");
+    GUI_TRACER_COMPONENT("CallbackButton::mouseUp");
     if (isEnabled()) {
       setHoverState();
       if (onClick)
@@ -34,6 +34,7 @@
 
 #include "dmt/utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -111,7 +112,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) noexcept override
   {
-    TRACER("Label::paint");
+    GUI_TRACER_COMPONENT("Label::paint");
     auto bounds = getLocalBounds();
 
     // Set background colour
@@ -34,6 +34,7 @@
 
 #include "dmt/utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -135,7 +136,7 @@ public:
     , type(_type)
     , orientation(_orientation)
   {
-    TRACER("LinearSlider::LinearSlider");
+    GUI_TRACER_COMPONENT("LinearSlider::LinearSlider");
     switch (_orientation) {
       case Orientation::Horizontal: {
         setSliderStyle(juce::Slider::LinearHorizontal);
@@ -167,7 +168,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) noexcept override
   {
-    TRACER("LinearSlider::paint");
+    GUI_TRACER_COMPONENT("LinearSlider::paint");
 
     // Calculate bounds
     auto bounds = getLocalBounds();
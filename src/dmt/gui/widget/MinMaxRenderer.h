@@ -22,7 +22,8 @@
  * samples to pixel columns, drawing only the minimum and maximum sample per
  * bin while preserving temporal order. This dramatically reduces path
  * complexity compared to per-sample rendering, trading visual fidelity for
- * significantly lower CPU usage at high sample densities.
+ * significantly lower CPU usage at high sample densities. At high zoom levels
+ * the bins are built from the min/max pyramid of the ring buffer instead.
  *
  * Authors:
  * Lunix-420 (Primary Author)
@@ -35,6 +36,7 @@
 
 #include "gui/widget/OscilloscopeRenderer.h"
 #include <JuceHeader.h>
+#include <array>
 
 //==============================================================================
 
@@ -61,6 +63,13 @@ namespace widget {
  * to stroke. The visual result is nearly identical to per-sample rendering at
  * typical zoom levels where multiple samples map to a single pixel.
  *
+ * If the ring buffer keeps a MinMaxPyramid and a pixel spans at least one
+ * pyramid bin, the pixel columns are built from the pyramid bins instead of
+ * the raw samples. The cost then only depends on the pixel width, and the
+ * whole history of the pyramid can be drawn. Pyramid bins don't know whether
+ * their minimum or maximum came first, so the extreme closer to the previous
+ * point is drawn first.
+ *
  * The renderer maintains persistent state (currentX and currentSample) between
  * frames to ensure visual continuity of the waveform across render calls.
  */
@@ -72,6 +81,7 @@ public:
   using RingBuffer = typename OscilloscopeRenderer<SampleType>::RingBuffer;
   using RenderContext =
     typename OscilloscopeRenderer<SampleType>::RenderContext;
+  using MinMaxPyramid = dmt::dsp::data::MinMaxPyramid<SampleType>;
 
   //============================================================================
   /**
@@ -94,58 +104,183 @@ public:
                    const RenderContext& _context) override
   {
     this->currentX = _context.drawStartX;
-    const auto path = buildPath(_ringBuffer, _channel, _context);
+    const auto path = buildMinMaxPath(_ringBuffer, _channel, _context);
     this->strokePath(_graphics, path, _context);
   }
 
+  //============================================================================
+  /**
+   * @brief Gets the oldest sample index the renderer can draw.
+   *
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _samplesPerPixel The current horizontal zoom.
+   *
+   * @return The sample index relative to the oldest sample of the ring
+   *         buffer. Negative if the pyramid reaches further back.
+   */
+  [[nodiscard]] inline int getOldestSampleIndex(
+    const RingBuffer& _ringBuffer,
+    float _samplesPerPixel) const noexcept override
+  {
+    const MinMaxPyramid* pyramid = _ringBuffer.getPyramid();
+    const int level = getPyramidLevel(pyramid, 1.0f / _samplesPerPixel);
+    if (level < 0)
+      return 0;
+
+    const int64_t endBin = static_cast<int64_t>(pyramid->getEndBin(level));
+    const int64_t firstBin =
+      std::max(endBin - pyramid->getNumBins(level), int64_t{ 0 });
+    const int64_t oldestCursor =
+      static_cast<int64_t>(_ringBuffer.getWriteCursor()) -
+      _ringBuffer.getNumSamples();
+    const int64_t index =
+      firstBin * MinMaxPyramid::getBinSize(level) - oldestCursor;
+    return static_cast<int>(std::clamp(
+      index, int64_t{ std::numeric_limits<int>::min() }, int64_t{ 0 }));
+  }
+
+  //============================================================================
+protected:
+  //============================================================================
+  /**
+   * @brief Builds the min/max path of a waveform segment.
+   *
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _channel The audio channel index to read from.
+   * @param _context Pre-computed rendering parameters for this frame.
+   *
+   * @return The path through the min/max extremes of each pixel column.
+   *
+   * @details
+   * Builds the path from the pyramid of the ring buffer if a pixel spans at
+   * least one pyramid bin, otherwise from the raw samples. Starts at the
+   * current position, so currentX must be set before.
+   */
+  [[nodiscard]] inline juce::Path buildMinMaxPath(
+    RingBuffer& _ringBuffer,
+    int _channel,
+    const RenderContext& _context)
+  {
+    const MinMaxPyramid* pyramid = _ringBuffer.getPyramid();
+    const int level = getPyramidLevel(pyramid, _context.pixelsPerSample);
+    return level < 0 ? buildPath(_ringBuffer, _channel, _context)
+                     : buildPyramidPath(
+                         *pyramid, level, _ringBuffer, _channel, _context);
+  }
+
   //============================================================================
 private:
+  //============================================================================
+  /** Number of lanes the extremes of a pixel column are searched with. */
+  constexpr static int NUM_LANES = 8;
+
   //============================================================================
   /**
-   * @brief Holds the min/max state for a single pixel column bin.
+   * @brief The extremes of the samples in a single pixel column.
    *
    * @details
-   * Tracks the minimum and maximum sample values encountered within a pixel
-   * column, along with their sample indices to determine temporal ordering.
+   * The indices are relative to the first sample of the column and refer to
+   * the first occurrence of each extreme, so the temporal order is known.
    */
-  struct Bin
+  struct Extremes
   {
-    SampleType minSample = static_cast<SampleType>(0.0f);
-    SampleType maxSample = static_cast<SampleType>(0.0f);
-    size_t minIndex = 0;
-    size_t maxIndex = 0;
-    size_t count = 0;
+    SampleType minSample;
+    SampleType maxSample;
+    int minIndex;
+    int maxIndex;
 
-    /** @brief Resets the bin with the first sample of a new pixel column. */
-    inline void reset(SampleType _sample, size_t _index) noexcept
+    /** @brief Returns true if the minimum sample occurred before the max. */
+    [[nodiscard]] inline bool minFirst() const noexcept
     {
-      minSample = _sample;
-      maxSample = _sample;
-      minIndex = _index;
-      maxIndex = _index;
-      count = 1;
+      return minIndex <= maxIndex;
     }
+  };
 
-    /** @brief Adds a sample to the bin, updating min/max as needed. */
-    inline void addSample(SampleType _sample, size_t _index) noexcept
-    {
-      if (_sample < minSample) {
-        minSample = _sample;
-        minIndex = _index;
+  //============================================================================
+  /**
+   * @brief Finds the extremes of a contiguous range of samples.
+   *
+   * @param _samples Pointer to the first sample.
+   * @param _numSamples The number of samples, at least one.
+   *
+   * @return The minimum and maximum with the index of their first occurrence.
+   *
+   * @details
+   * Every lane keeps its own extremes and indices, updated with selects
+   * instead of branches, so the compiler vectorizes the main loop. Indices
+   * only grow within a lane, and ties between lanes are resolved to the
+   * lower index, so the result matches a sequential search.
+   */
+  [[nodiscard]] static inline Extremes findExtremes(
+    const SampleType* _samples,
+    const int _numSamples) noexcept
+  {
+    if (_numSamples < NUM_LANES) {
+      Extremes extremes{ _samples[0], _samples[0], 0, 0 };
+      for (int i = 1; i < _numSamples; ++i) {
+        if (_samples[i] < extremes.minSample) {
+          extremes.minSample = _samples[i];
+          extremes.minIndex = i;
+        }
+        if (_samples[i] > extremes.maxSample) {
+          extremes.maxSample = _samples[i];
+          extremes.maxIndex = i;
+        }
       }
-      if (_sample > maxSample) {
-        maxSample = _sample;
-        maxIndex = _index;
+      return extremes;
+    }
+
+    alignas(64) std::array<SampleType, NUM_LANES> minima;
+    alignas(64) std::array<SampleType, NUM_LANES> maxima;
+    alignas(64) std::array<int, NUM_LANES> minIndices;
+    alignas(64) std::array<int, NUM_LANES> maxIndices;
+    for (int lane = 0; lane < NUM_LANES; ++lane) {
+      minima[lane] = _samples[lane];
+      maxima[lane] = _samples[lane];
+      minIndices[lane] = lane;
+      maxIndices[lane] = lane;
+    }
+
+    int i = NUM_LANES;
+    for (; i + NUM_LANES <= _numSamples; i += NUM_LANES) {
+      for (int lane = 0; lane < NUM_LANES; ++lane) {
+        const SampleType sample = _samples[i + lane];
+        const bool isLower = sample < minima[lane];
+        const bool isHigher = sample > maxima[lane];
+        minima[lane] = isLower ? sample : minima[lane];
+        maxima[lane] = isHigher ? sample : maxima[lane];
+        minIndices[lane] = isLower ? i + lane : minIndices[lane];
+        maxIndices[lane] = isHigher ? i + lane : maxIndices[lane];
+      }
+    }
+    for (int lane = 0; i < _numSamples; ++i, ++lane) {
+      if (_samples[i] < minima[lane]) {
+        minima[lane] = _samples[i];
+        minIndices[lane] = i;
+      }
+      if (_samples[i] > maxima[lane]) {
+        maxima[lane] = _samples[i];
+        maxIndices[lane] = i;
       }
-      ++count;
     }
 
-    /** @brief Returns true if the minimum sample occurred before the max. */
-    [[nodiscard]] inline bool minFirst() const noexcept
-    {
-      return minIndex <= maxIndex;
+    Extremes extremes{ minima[0], maxima[0], minIndices[0], maxIndices[0] };
+    for (int lane = 1; lane < NUM_LANES; ++lane) {
+      if (minima[lane] < extremes.minSample ||
+          (minima[lane] == extremes.minSample &&
+           minIndices[lane] < extremes.minIndex)) {
+        extremes.minSample = minima[lane];
+        extremes.minIndex = minIndices[lane];
+      }
+      if (maxima[lane] > extremes.maxSample ||
+          (maxima[lane] == extremes.maxSample &&
+           maxIndices[lane] < extremes.maxIndex)) {
+        extremes.maxSample = maxima[lane];
+        extremes.maxIndex = maxIndices[lane];
+      }
     }
-  };
+    return extremes;
+  }
 
   //============================================================================
   /**
@@ -158,13 +293,15 @@ private:
    * @return The constructed JUCE Path representing the waveform segment.
    *
    * @details
-   * Iterates through all samples, grouping them into pixel column bins.
-   * For each completed bin, two points are added to the path in temporal
-   * order (whichever extreme occurred first is drawn first). This preserves
-   * the waveform's directional movement while reducing the point count to
-   * at most two per pixel column.
+   * The samples of a frame are contiguous in the ring buffer, so every pixel
+   * column is one span of samples. The first sample of the next column is
+   * calculated once per column, and the extremes of the span are found with
+   * findExtremes(). For each column, two points are added to the path in
+   * temporal order (whichever extreme occurred first is drawn first). This
+   * preserves the waveform's directional movement while reducing the point
+   * count to at most two per pixel column.
    *
-   * When only one sample falls in a bin, a single point is drawn.
+   * When only one sample falls in a column, a single point is drawn.
    * The persistent currentX tracks the pixel column boundary for sub-pixel
    * continuity between frames.
    */
@@ -180,81 +317,181 @@ private:
                                          _context.halfHeight,
                                          _context.amplitude));
 
+    const int sampleCount = _context.sampleCount;
+    const SampleType* samples =
+      _ringBuffer.getReadPointer(_channel, _context.firstSampleIndex);
     const float samplesPerPixel = 1.0f / _context.pixelsPerSample;
-    float nextBinBoundary = this->currentX + 1.0f;
 
-    Bin bin;
+    int firstSample = 0;
+    while (firstSample < sampleCount) {
+      // Sample i is drawn at currentX + (i + 1) * pixelsPerSample
+      const float firstX =
+        this->currentX +
+        static_cast<float>(firstSample + 1) * _context.pixelsPerSample;
+      const float column = std::floor(firstX);
+      const float nextColumnSample =
+        std::ceil((column + 1.0f - this->currentX) * samplesPerPixel - 1.0f);
+      const int endSample = static_cast<int>(
+        std::clamp(nextColumnSample,
+                   static_cast<float>(firstSample + 1),
+                   static_cast<float>(sampleCount)));
+
+      const int numSamples = endSample - firstSample;
+      const Extremes extremes =
+        findExtremes(samples + firstSample, numSamples);
+      const float lastX = this->currentX + static_cast<float>(endSample) *
+                                             _context.pixelsPerSample;
+      const float binX = std::min(lastX, column + 0.5f);
+      const float minY = this->sampleToY(
+        extremes.minSample, _context.halfHeight, _context.amplitude);
+      const float maxY = this->sampleToY(
+        extremes.maxSample, _context.halfHeight, _context.amplitude);
+
+      if (numSamples == 1) {
+        // Single sample in column, draw one point
+        path.lineTo(binX, minY);
+      } else if (extremes.minFirst()) {
+        // Multiple samples, draw min and max in temporal order
+        path.lineTo(binX, minY);
+        path.lineTo(binX, maxY);
+      } else {
+        path.lineTo(binX, maxY);
+        path.lineTo(binX, minY);
+      }
+
+      firstSample = endSample;
+    }
+
+    // Update persistent state for frame continuity
+    const float totalAdvance =
+      static_cast<float>(sampleCount) * _context.pixelsPerSample;
+    this->currentX += totalAdvance;
+    if (sampleCount > 0)
+      this->currentSample = samples[sampleCount - 1];
+
+    return path;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the pyramid level to draw from.
+   *
+   * @param _pyramid The pyramid of the ring buffer, may be nullptr.
+   * @param _pixelsPerSample The horizontal spacing in pixels per sample.
+   *
+   * @return The level index, or -1 if raw samples should be drawn.
+   */
+  [[nodiscard]] inline static int getPyramidLevel(
+    const MinMaxPyramid* _pyramid,
+    const float _pixelsPerSample) noexcept
+  {
+    if (_pyramid == nullptr)
+      return -1;
+    return _pyramid->getLevelFor(1.0f / _pixelsPerSample);
+  }
+
+  //============================================================================
+  /**
+   * @brief Builds a min/max binned path from the bins of a pyramid level.
+   *
+   * @param _pyramid The pyramid of the ring buffer.
+   * @param _level The pyramid level to read from.
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _channel The audio channel index to read from.
+   * @param _context Pre-computed rendering parameters for this frame.
+   *
+   * @return The constructed JUCE Path representing the waveform segment.
+   *
+   * @details
+   * Every pyramid bin is drawn in the frame that reaches its end, so bins
+   * that are cut by a frame boundary are drawn exactly once. Pixel columns
+   * are formed the same way as in buildPath().
+   */
+  [[nodiscard]] inline juce::Path buildPyramidPath(
+    const MinMaxPyramid& _pyramid,
+    const int _level,
+    RingBuffer& _ringBuffer,
+    int _channel,
+    const RenderContext& _context)
+  {
+    juce::Path path;
+    float lastY = this->sampleToY(
+      this->currentSample, _context.halfHeight, _context.amplitude);
+    path.startNewSubPath(this->currentX, lastY);
+
+    const int64_t binSize = MinMaxPyramid::getBinSize(_level);
+    const int64_t firstCursor =
+      static_cast<int64_t>(_ringBuffer.getWriteCursor()) -
+      _ringBuffer.getNumSamples() + _context.firstSampleIndex;
+    const int64_t endCursor = firstCursor + _context.sampleCount;
+
+    const int64_t availableEndBin =
+      static_cast<int64_t>(_pyramid.getEndBin(_level));
+    const int64_t availableFirstBin = std::max(
+      availableEndBin - _pyramid.getNumBins(_level), int64_t{ 0 });
+    const int64_t firstBin =
+      std::max(std::max(firstCursor, int64_t{ 0 }) / binSize, availableFirstBin);
+    const int64_t endBin =
+      std::min(std::max(endCursor, int64_t{ 0 }) / binSize, availableEndBin);
+
+    const uint64_t firstPyramidBin = static_cast<uint64_t>(firstBin);
+    const SampleType* minima =
+      _pyramid.getMinima(_level, _channel, firstPyramidBin);
+    const SampleType* maxima =
+      _pyramid.getMaxima(_level, _channel, firstPyramidBin);
+
+    const float pixelsPerBin =
+      static_cast<float>(binSize) * _context.pixelsPerSample;
+    float nextBinBoundary = this->currentX + 1.0f;
+    SampleType minSample = static_cast<SampleType>(0.0f);
+    SampleType maxSample = static_cast<SampleType>(0.0f);
     bool binActive = false;
 
-    for (size_t i = 0; i < static_cast<size_t>(_context.sampleCount); ++i) {
-      const int sampleIndex = _context.firstSampleIndex + static_cast<int>(i);
-      const SampleType sample = _ringBuffer.getSample(_channel, sampleIndex);
-      const float sampleX =
-        this->currentX + static_cast<float>(i + 1) * _context.pixelsPerSample;
+    for (int64_t bin = firstBin; bin < endBin; ++bin) {
+      const size_t offset = static_cast<size_t>(bin - firstBin);
+      const float binX =
+        this->currentX +
+        static_cast<float>((bin + 1) * binSize - firstCursor) *
+          _context.pixelsPerSample;
 
       if (!binActive) {
-        bin.reset(sample, i);
+        minSample = minima[offset];
+        maxSample = maxima[offset];
         binActive = true;
       } else {
-        bin.addSample(sample, i);
+        minSample = std::min(minSample, minima[offset]);
+        maxSample = std::max(maxSample, maxima[offset]);
       }
 
-      // Check if the next sample would cross into a new pixel column
-      const float nextSampleX =
-        this->currentX + static_cast<float>(i + 2) * _context.pixelsPerSample;
-      const bool isLastSample =
-        (i + 1 >= static_cast<size_t>(_context.sampleCount));
-      const bool crossesBoundary = (nextSampleX >= nextBinBoundary);
-
-      if (isLastSample || crossesBoundary) {
-        // Finalize the current bin
-        const float binX = std::min(sampleX, nextBinBoundary - 0.5f);
-
-        if (bin.count == 1) {
-          // Single sample in bin, draw one point
-          path.lineTo(binX,
-                      this->sampleToY(bin.minSample,
-                                      _context.halfHeight,
-                                      _context.amplitude));
-        } else {
-          // Multiple samples, draw min and max in temporal order
-          if (bin.minFirst()) {
-            path.lineTo(binX,
-                        this->sampleToY(bin.minSample,
-                                        _context.halfHeight,
-                                        _context.amplitude));
-            path.lineTo(binX,
-                        this->sampleToY(bin.maxSample,
-                                        _context.halfHeight,
-                                        _context.amplitude));
-          } else {
-            path.lineTo(binX,
-                        this->sampleToY(bin.maxSample,
-                                        _context.halfHeight,
-                                        _context.amplitude));
-            path.lineTo(binX,
-                        this->sampleToY(bin.minSample,
-                                        _context.halfHeight,
-                                        _context.amplitude));
-          }
-        }
+      const float nextBinX = binX + pixelsPerBin;
+      const bool isLastBin = (bin + 1 >= endBin);
+      const bool crossesBoundary = (nextBinX >= nextBinBoundary);
+
+      if (isLastBin || crossesBoundary) {
+        // Draw the extreme closer to the previous point first
+        const float x = std::min(binX, nextBinBoundary - 0.5f);
+        const float minY = this->sampleToY(
+          minSample, _context.halfHeight, _context.amplitude);
+        const float maxY = this->sampleToY(
+          maxSample, _context.halfHeight, _context.amplitude);
+        const bool minFirst = std::abs(minY - lastY) <= std::abs(maxY - lastY);
+        path.lineTo(x, minFirst ? minY : maxY);
+        path.lineTo(x, minFirst ? maxY : minY);
+        lastY = minFirst ? maxY : minY;
 
         if (crossesBoundary) {
-          nextBinBoundary = std::floor(nextSampleX) + 1.0f;
+          nextBinBoundary = std::floor(nextBinX) + 1.0f;
           binActive = false;
         }
       }
     }
 
     // Update persistent state for frame continuity
-    const float totalAdvance =
+    this->currentX +=
       static_cast<float>(_context.sampleCount) * _context.pixelsPerSample;
-    this->currentX += totalAdvance;
-    if (_context.sampleCount > 0) {
-      const int lastIndex =
-        _context.firstSampleIndex + _context.sampleCount - 1;
+    const int lastIndex = _context.firstSampleIndex + _context.sampleCount - 1;
+    if (lastIndex >= 0 && _context.sampleCount > 0)
       this->currentSample = _ringBuffer.getSample(_channel, lastIndex);
-    }
 
     return path;
   }
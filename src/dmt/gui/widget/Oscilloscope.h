@@ -32,7 +32,12 @@
 
 #include "gui/widget/MinMaxRenderer.h"
 #include "gui/widget/PathStrokeRenderer.h"
+#include "gui/widget/RdpRenderer.h"
+#include "gui/widget/ScanlineRenderer.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
+#include <array>
+#include <cstring>
 #include <memory>
 
 //==============================================================================
@@ -49,20 +54,42 @@ namespace widget {
  *
  * @details
  * This class provides a high-performance oscilloscope visualization for audio
- * buffers, optimized for real-time use in GUI applications. It leverages a
- * background thread to render the waveform into a JUCE image, which can be
- * efficiently displayed in the GUI. The design ensures thread safety and
- * minimal locking overhead, using a read-write lock for image access.
+ * buffers, optimized for real-time use in GUI applications. Frames are
+ * rendered into a JUCE image by renderFrame(), which the owner calls from a
+ * background thread, usually a dmt::utility::RenderScheduler worker. The
+ * image can then be efficiently displayed in the GUI.
+ *
+ * Finished frames are handed to the message thread through a lock-free triple
+ * buffer. The rendering thread draws into its own canvas, copies it into the
+ * back frame and publishes that with a single atomic exchange. The message
+ * thread picks up the latest published frame in getFrame() without copying,
+ * allocating or waiting on the rendering thread.
+ *
+ * The canvas is circular. Scrolling only advances the write column, which is
+ * where the oldest column of the waveform starts, and new content is drawn
+ * into the strip in front of it. Every frame keeps the write column it was
+ * published with, so the display blits the two halves in order. Only the
+ * columns that changed since a frame was last published are copied into it.
+ *
+ * The canvas is rendered at a resolution relative to the logical bounds. A
+ * resolution of 1 renders one pixel per logical pixel. The display scale
+ * renders at full physical resolution, so the trace stays sharp on HiDPI
+ * screens. The frames keep that resolution and are scaled down when they
+ * are blitted.
  *
  * The oscilloscope is intended to be used with a lock-free ring buffer for
  * audio data, and supports customization of amplitude, thickness, and
  * samples-per-pixel for flexible display scaling.
  *
- * The rendering thread is started upon construction and stopped on destruction.
- * The image is updated periodically, and can be retrieved via getImage().
+ * The oscilloscope doesn't own a thread. The owner must make sure no frame
+ * is being rendered when the oscilloscope is destroyed.
+ * The image is updated with every rendered frame, and can be retrieved via
+ * getFrame(). Resizing and swapping the renderer are still serialized with
+ * the rendering thread by a lock, but the message thread never takes it while
+ * painting.
  */
 template<typename SampleType>
-class alignas(64) Oscilloscope : public juce::Thread
+class alignas(64) Oscilloscope
 {
   //==============================================================================
 public:
@@ -70,7 +97,6 @@ public:
   using Image = juce::Image;
   using Graphics = juce::Graphics;
   using String = juce::String;
-  using Thread = juce::Thread;
   using PixelFormat = juce::Image::PixelFormat;
   using ReadWriteLock = juce::ReadWriteLock;
   using Settings = dmt::Settings;
@@ -78,49 +104,73 @@ public:
 
   //==============================================================================
   /**
-   * @brief Constructs the oscilloscope and starts the rendering thread.
+   * @brief A finished image of the circular canvas.
+   *
+   * @details
+   * The column at writeColumn is the leftmost one of the waveform. Columns
+   * to the left of it continue at the right end of the waveform.
+   */
+  struct Frame
+  {
+    Image image = Image(PixelFormat::ARGB, 1, 1, true);
+    int writeColumn = 0;
+  };
+
+  //==============================================================================
+  /**
+   * @brief Constructs the oscilloscope.
    *
    * @param _ringBuffer Reference to the ring buffer containing audio samples.
    * @param _channel The audio channel to visualize.
    *
    * @details
-   * The rendering thread is started immediately. The oscilloscope will read
-   * from the provided ring buffer and visualize the specified channel.
+   * The oscilloscope will read from the provided ring buffer and visualize
+   * the specified channel whenever renderFrame() is called.
    */
   explicit Oscilloscope(RingBuffer& _ringBuffer,
                         const int32_t _channel,
                         const float& _sizeFactor) noexcept
-    : Thread(String("Oscilloscope" + juce::String(_channel)))
-    , ringBuffer(_ringBuffer)
+    : ringBuffer(_ringBuffer)
     , channel(_channel)
     , size(_sizeFactor)
-    , renderer(std::make_unique<MinMaxRenderer<SampleType>>())
+    , renderer(std::make_unique<ScanlineRenderer<SampleType>>())
   {
-    startThread();
   }
 
   //==============================================================================
   /**
-   * @brief Destructor. Stops the rendering thread.
+   * @brief Renders the latest audio samples and publishes the frame.
    *
    * @details
-   * Ensures the rendering thread is stopped gracefully before destruction.
+   * Called from a background thread, never from two threads at once. The
+   * render lock only guards against resizing and renderer swaps, never
+   * against painting.
    */
-  inline ~Oscilloscope() noexcept override { stopThread(1000); }
+  inline void renderFrame()
+  {
+    const ScopedWriteLock writeLock(renderLock);
+    render();
+    publishFrame();
+  }
 
   //==============================================================================
   /**
-   * @brief Retrieves a copy of the current oscilloscope image.
+   * @brief Retrieves the latest finished oscilloscope frame.
    *
-   * @return A copy of the rendered JUCE image.
+   * @return The front frame of the triple buffer.
    *
    * @details
-   * The returned image is thread-safe and can be used in the GUI.
+   * If the rendering thread published a new frame since the last call, it
+   * becomes the front frame. The rendering thread never touches the front
+   * frame, so the reference stays valid and unchanged until the next call.
+   * Must only be called from the message thread.
    */
-  [[nodiscard]] inline juce::Image getImage() const
+  [[nodiscard]] inline const Frame& getFrame() noexcept
   {
-    const ScopedReadLock readLock(imageLock);
-    return image.createCopy();
+    if (middleFrame.load(std::memory_order_relaxed) & FRESH_FRAME)
+      frontFrame = middleFrame.exchange(frontFrame, std::memory_order_acq_rel) &
+                   FRAME_INDEX_MASK;
+    return frames[frontFrame];
   }
 
   //==============================================================================
@@ -134,8 +184,39 @@ public:
    */
   inline void setBounds(juce::Rectangle<int> _newBounds)
   {
-    resizeImage(_newBounds.getWidth(), _newBounds.getHeight());
+    resizeImage(_newBounds.getWidth(), _newBounds.getHeight(), resolution);
     bounds = _newBounds;
+    redrawRequested = true;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Sets the number of image pixels per logical pixel.
+   *
+   * @param _newResolution The new resolution, usually between 1 and the
+   * display scale.
+   *
+   * @details
+   * Reallocates the images and redraws them from the history of the ring
+   * buffer. Does nothing if the resolution didn't change.
+   */
+  inline void setResolution(const float _newResolution)
+  {
+    if (juce::approximatelyEqual(resolution, _newResolution))
+      return;
+    resizeImage(bounds.getWidth(), bounds.getHeight(), _newResolution);
+    redrawRequested = true;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the number of image pixels per logical pixel.
+   *
+   * @return The resolution the frames are rendered at.
+   */
+  [[nodiscard]] inline float getResolution() const noexcept
+  {
+    return resolution;
   }
 
   //==============================================================================
@@ -156,11 +237,33 @@ public:
    * @param _newRawSamplesPerPixel The new samples-per-pixel value.
    *
    * @details
-   * Adjusts the horizontal scaling of the waveform.
+   * Adjusts the horizontal scaling of the waveform. The image is redrawn from
+   * the available history with the next frame instead of scrolling the new
+   * scaling in.
    */
   inline void setRawSamplesPerPixel(float _newRawSamplesPerPixel) noexcept
   {
+    if (juce::approximatelyEqual(rawSamplesPerPixel, _newRawSamplesPerPixel))
+      return;
     rawSamplesPerPixel = _newRawSamplesPerPixel;
+    redrawRequested = true;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Gets the number of values the full width of the trace spans.
+   *
+   * @return The number of visible values.
+   *
+   * @details
+   * Matches what render() draws: the trace is renderWidth image pixels wide
+   * and every image pixel covers rawSamplesPerPixel * size / resolution
+   * values.
+   */
+  [[nodiscard]] inline float getNumVisibleValues() const noexcept
+  {
+    return static_cast<float>(renderWidth) * rawSamplesPerPixel * size /
+           resolution;
   }
 
   //==============================================================================
@@ -198,67 +301,78 @@ public:
    * @param _newRenderer A unique pointer to the new renderer implementation.
    *
    * @details
-   * Swaps the current rendering strategy under the write lock to ensure
+   * Swaps the current rendering strategy under the render lock to ensure
    * thread safety with the rendering thread. The previous renderer is
    * destroyed when the new one is set.
    */
   inline void setRenderer(std::unique_ptr<Renderer> _newRenderer)
   {
-    const ScopedWriteLock writeLock(imageLock);
+    const ScopedWriteLock writeLock(renderLock);
     renderer = std::move(_newRenderer);
   }
 
   //==============================================================================
 protected:
-  //==============================================================================
-  /**
-   * @brief Main rendering thread loop.
-   *
-   * @details
-   * Periodically updates the oscilloscope image by rendering the latest audio
-   * samples. Uses a write lock to ensure exclusive access to the image.
-   * The wait interval is set high to minimize CPU usage; rendering is not
-   * continuous but event-driven.
-   */
-  inline void run() override
-  {
-    while (!threadShouldExit()) {
-      wait(10000);
-      const ScopedWriteLock writeLock(imageLock);
-      render();
-    }
-  }
-
   //==============================================================================
   /**
    * @brief Resizes the internal image buffer and draws the midline.
    *
-   * @param _width The new image width.
-   * @param _height The new image height.
+   * @param _width The new logical width.
+   * @param _height The new logical height.
+   * @param _resolution The number of image pixels per logical pixel.
    *
    * @details
-   * The image is resized and a horizontal midline is drawn for reference.
+   * The canvas is resized and a horizontal midline is drawn for reference.
+   * All frames of the triple buffer are reallocated and reset to the new
+   * canvas, starting at write column zero. This runs on the message thread,
+   * so the front frame can't be in use by a paint call at the same time.
    */
-  inline void resizeImage(const int _width, const int _height)
+  inline void resizeImage(const int _width,
+                          const int _height,
+                          const float _resolution)
   {
-    TRACER("Oscilloscope::resizeImage");
-    const ScopedWriteLock writeLock(imageLock);
+    GUI_TRACER_COMPONENT("Oscilloscope::resizeImage");
+    const ScopedWriteLock writeLock(renderLock);
+    resolution = _resolution;
 
     // Avoid illegal sizes
     if (_width <= 0 || _height <= 0) {
       return;
     }
 
-    image = Image(PixelFormat::ARGB, _width + 10, _height, true);
+    renderWidth = juce::roundToInt(static_cast<float>(_width) * resolution);
+    renderHeight = juce::roundToInt(static_cast<float>(_height) * resolution);
+
+    // Software images, the renderers and the frame copies access the pixels
+    canvas = Image(PixelFormat::ARGB,
+                   renderWidth + 10,
+                   renderHeight,
+                   true,
+                   juce::SoftwareImageType());
+    writeColumn = 0;
     subPixelOffset = 0.0f;
 
-    juce::Graphics imageGraphics(image);
+    juce::Graphics imageGraphics(canvas);
     imageGraphics.setColour(juce::Colours::white);
     imageGraphics.drawLine(0,
-                           static_cast<float>(_height) / 2.0f,
-                           static_cast<float>(_width + 10),
-                           static_cast<float>(_height) / 2.0f,
-                           3.0f);
+                           static_cast<float>(renderHeight) / 2.0f,
+                           static_cast<float>(renderWidth + 10),
+                           static_cast<float>(renderHeight) / 2.0f,
+                           3.0f * resolution);
+
+    for (auto& frame : frames) {
+      frame.image = Image(PixelFormat::ARGB,
+                          renderWidth + 10,
+                          renderHeight,
+                          false,
+                          juce::SoftwareImageType());
+      frame.writeColumn = 0;
+      copyPixels(canvas, frame.image, canvas.getBounds());
+    }
+    staleColumns.fill(0);
+    backFrame = 0;
+    frontFrame = 1;
+    middleFrame.store(2, std::memory_order_release);
   }
 
   //==============================================================================
@@ -266,17 +380,26 @@ protected:
    * @brief Renders the oscilloscope waveform into the image.
    *
    * @details
-   * Reads samples from the ring buffer, updates the image by moving the
-   * existing content, clears the new region, and draws the waveform path.
+   * Reads samples from the ring buffer, scrolls the canvas by advancing the
+   * write column, clears the new region, and draws the waveform path.
+   * The renderer draws in unwrapped coordinates, the graphics origin is moved
+   * to the write column and the context tells it where the canvas wraps.
+   * Everything is measured in image pixels, so the zoom and the stroke are
+   * scaled by the resolution.
    * Uses explicit type conversions for safety and clarity.
    */
   inline void render()
   {
-    TRACER("Oscilloscope::render");
-    const int width = bounds.getWidth();
-    const int height = bounds.getHeight();
+    GUI_TRACER_BLOCK("Oscilloscope::render");
+    const int width = renderWidth;
+    const int height = renderHeight;
     const int halfHeight = height / 2;
-    float samplesPerPixel = rawSamplesPerPixel * size;
+    const int canvasWidth = canvas.getWidth();
+    const float pixelSize = size * resolution;
+    float samplesPerPixel = rawSamplesPerPixel * size / resolution;
+
+    if (redrawRequested.exchange(false)) [[unlikely]]
+      redraw(samplesPerPixel);
 
     const int bufferSize = ringBuffer.getNumSamples();
     const int readPosition = ringBuffer.getReadPosition(channel);
@@ -293,22 +416,18 @@ protected:
     const int pixelToDraw = static_cast<int>(totalShift);
     ringBuffer.incrementReadPosition(channel, samplesToDraw);
 
-    // Image move
-    const int destX = 0 - pixelToDraw;
-    image.moveImageSection(destX,      // destX
-                           0,          // destY
-                           0,          // srcX
-                           0,          // srcY
-                           width + 10, // width
-                           height);    // height
+    // Scroll by advancing the write column
+    const int scroll = jmin(pixelToDraw, canvasWidth);
+    writeColumn = (writeColumn + scroll) % canvasWidth;
 
     // Clear the new part of the image
-    juce::Rectangle<int> clearRect(
-      width - pixelToDraw + 10, 0, pixelToDraw, height);
-    image.clear(clearRect, juce::Colours::transparentBlack);
+    forEachSpan(canvasWidth - scroll, scroll, [&](int _x, int _width) {
+      canvas.clear({ _x, 0, _width, height }, juce::Colours::transparentBlack);
+    });
 
     // Delegate drawing to the active renderer
-    juce::Graphics imageGraphics(image);
+    juce::Graphics imageGraphics(canvas);
+    imageGraphics.setOrigin(writeColumn, 0);
     const typename Renderer::RenderContext context{
       firstSamplesToDraw,
       samplesToDraw,
@@ -317,14 +436,172 @@ protected:
       halfHeight,
       amplitude,
       thickness,
-      size
+      pixelSize,
+      static_cast<float>(canvasWidth - writeColumn),
+      static_cast<float>(canvasWidth),
+      &canvas
     };
     subPixelOffset = totalShift - static_cast<float>(pixelToDraw);
     renderer->draw(imageGraphics, ringBuffer, channel, context);
+
+    // The stroke reaches back behind the start of the new segment
+    const int firstDirtyColumn = static_cast<int>(
+      std::floor(context.drawStartX - thickness * pixelSize) - 1.0f);
+    const int dirtyColumns =
+      canvasWidth - std::clamp(firstDirtyColumn, 0, canvasWidth);
+    for (auto& stale : staleColumns)
+      stale = jmin(canvasWidth, jmax(stale + scroll, dirtyColumns));
+  }
+
+  //==============================================================================
+  /**
+   * @brief Redraws the whole image from the history of the ring buffer.
+   *
+   * @param _samplesPerPixel The current horizontal zoom.
+   *
+   * @details
+   * Draws everything that was already read, as far back as the renderer can
+   * reach, so the image ends where the next regular frame continues.
+   */
+  inline void redraw(const float _samplesPerPixel)
+  {
+    GUI_TRACER_BLOCK("Oscilloscope::redraw");
+    const int width = renderWidth;
+    const int readPosition = ringBuffer.getReadPosition(channel);
+    const int oldestIndex =
+      renderer->getOldestSampleIndex(ringBuffer, _samplesPerPixel);
+    const int maxSamplesToDraw = static_cast<int>(
+      std::floor(_samplesPerPixel * static_cast<float>(width)));
+    const int samplesToDraw =
+      jmin(readPosition - oldestIndex, maxSamplesToDraw);
+
+    canvas.clear(canvas.getBounds(), juce::Colours::transparentBlack);
+    writeColumn = 0;
+    subPixelOffset = 0.0f;
+    staleColumns.fill(canvas.getWidth());
+    if (samplesToDraw <= 0)
+      return;
+
+    juce::Graphics imageGraphics(canvas);
+    const typename Renderer::RenderContext context{
+      readPosition - samplesToDraw,
+      samplesToDraw,
+      static_cast<float>(width) -
+        static_cast<float>(samplesToDraw) / _samplesPerPixel,
+      1.0f / _samplesPerPixel,
+      renderHeight / 2,
+      amplitude,
+      thickness,
+      size * resolution,
+      static_cast<float>(canvas.getWidth()),
+      static_cast<float>(canvas.getWidth()),
+      &canvas
+    };
+    renderer->draw(imageGraphics, ringBuffer, channel, context);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Updates the back frame from the canvas and publishes it.
+   *
+   * @details
+   * Only the columns that changed since the back frame was last published
+   * are copied. The back frame is then exchanged with the middle slot, marked
+   * as fresh. The release half of the exchange makes the copied pixels
+   * visible to the message thread once it acquires the frame in getFrame().
+   */
+  inline void publishFrame() noexcept
+  {
+    GUI_TRACER_COMPONENT("Oscilloscope::publishFrame");
+    Frame& frame = frames[backFrame];
+    int& stale = staleColumns[backFrame];
+    forEachSpan(canvas.getWidth() - stale, stale, [&](int _x, int _width) {
+      copyPixels(canvas, frame.image, { _x, 0, _width, canvas.getHeight() });
+    });
+    frame.writeColumn = writeColumn;
+    stale = 0;
+
+    backFrame = middleFrame.exchange(backFrame | FRESH_FRAME,
+                                     std::memory_order_acq_rel) &
+                FRAME_INDEX_MASK;
+  }
+
+  //==============================================================================
+  /**
+   * @brief Calls a function for the canvas spans covering a column range.
+   *
+   * @param _firstColumn The first column, counted from the write column.
+   * @param _numColumns The number of columns.
+   * @param _function Called with the x position and width of each span.
+   *
+   * @details
+   * The range is split in two where it wraps around the end of the canvas.
+   */
+  template<typename Function>
+  inline void forEachSpan(const int _firstColumn,
+                          const int _numColumns,
+                          Function&& _function) const
+  {
+    if (_numColumns <= 0)
+      return;
+
+    const int canvasWidth = canvas.getWidth();
+    const int start = (writeColumn + _firstColumn) % canvasWidth;
+    const int firstWidth = jmin(_numColumns, canvasWidth - start);
+    _function(start, firstWidth);
+    if (_numColumns > firstWidth)
+      _function(0, _numColumns - firstWidth);
+  }
+
+  //==============================================================================
+  /**
+   * @brief Copies an area of one image into another of the same size.
+   *
+   * @param _source The image to read from.
+   * @param _destination The image to overwrite.
+   * @param _area The area to copy, in both images.
+   *
+   * @details
+   * Copies line by line through the bitmap data instead of drawing, so
+   * transparent pixels replace the destination rather than blending into it.
+   */
+  static inline void copyPixels(const Image& _source,
+                                Image& _destination,
+                                const juce::Rectangle<int>& _area) noexcept
+  {
+    const auto area = _area.getIntersection(_source.getBounds())
+                        .getIntersection(_destination.getBounds());
+    if (area.isEmpty())
+      return;
+
+    const int height = area.getHeight();
+    const Image::BitmapData source(_source,
+                                   area.getX(),
+                                   area.getY(),
+                                   area.getWidth(),
+                                   height,
+                                   Image::BitmapData::readOnly);
+    Image::BitmapData destination(_destination,
+                                  area.getX(),
+                                  area.getY(),
+                                  area.getWidth(),
+                                  height,
+                                  Image::BitmapData::writeOnly);
+    const size_t lineSize = static_cast<size_t>(area.getWidth()) *
+                            static_cast<size_t>(source.pixelStride);
+
+    for (int y = 0; y < height; ++y)
+      std::memcpy(
+        destination.getLinePointer(y), source.getLinePointer(y), lineSize);
   }
 
   //==============================================================================
 private:
+  //==============================================================================
+  // Triple buffer flags
+  constexpr static int FRESH_FRAME = 4;
+  constexpr static int FRAME_INDEX_MASK = 3;
+
   //==============================================================================
   // Members initialized in the initializer list
   RingBuffer& ringBuffer;
@@ -333,11 +610,21 @@ private:
   //==============================================================================
   // Other members
   juce::Rectangle<int> bounds = juce::Rectangle<int>(0, 0, 1, 1);
-  Image image = Image(PixelFormat::ARGB, 1, 1, true);
-  ReadWriteLock imageLock;
+  float resolution = 1.0f;
+  int renderWidth = 1;
+  int renderHeight = 1;
+  Image canvas = Image(PixelFormat::ARGB, 1, 1, true);
+  int writeColumn = 0;
+  std::array<Frame, 3> frames;
+  std::array<int, 3> staleColumns{};
+  int backFrame = 0;
+  int frontFrame = 1;
+  std::atomic<int> middleFrame = 2;
+  ReadWriteLock renderLock;
 
   std::unique_ptr<Renderer> renderer;
   float subPixelOffset = 0.0f;
+  std::atomic<bool> redrawRequested = false;
   float rawSamplesPerPixel = 10.0f;
   float amplitude = 1.0f;
   float thickness = 3.0f;
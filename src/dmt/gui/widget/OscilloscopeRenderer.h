@@ -105,6 +105,15 @@ public:
 
     /** Global size scaling factor. */
     float sizeFactor;
+
+    /** X coordinate where the circular image wraps around. */
+    float wrapX;
+
+    /** Width of the circular image, the distance to the wrapped start. */
+    float wrapWidth;
+
+    /** The image behind the Graphics context, for direct pixel access. */
+    juce::Image* image;
   };
 
   //============================================================================
@@ -135,6 +144,28 @@ public:
                     int _channel,
                     const RenderContext& _context) = 0;
 
+  //============================================================================
+  /**
+   * @brief Gets the oldest sample index the renderer can draw.
+   *
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _samplesPerPixel The current horizontal zoom.
+   *
+   * @return The sample index relative to the oldest sample of the ring
+   *         buffer. Renderers that can draw from a longer history return a
+   *         negative index.
+   *
+   * @details
+   * Used by the Oscilloscope to redraw the whole image at once, e.g. after
+   * the zoom changed. By default only the ring buffer itself can be drawn.
+   */
+  [[nodiscard]] virtual int getOldestSampleIndex(
+    const RingBuffer& /*_ringBuffer*/,
+    float /*_samplesPerPixel*/) const noexcept
+  {
+    return 0;
+  }
+
   //============================================================================
 protected:
   //============================================================================
@@ -165,7 +196,9 @@ protected:
    *
    * @details
    * Configures the stroke type with beveled joints and rounded end caps,
-   * and uses a solid white colour for the stroke.
+   * and uses a solid white colour for the stroke. If the stroke reaches past
+   * the wrap point of the circular image, it is stroked a second time shifted
+   * back to the start of the image.
    */
   inline void strokePath(juce::Graphics& _graphics,
                          const juce::Path& _path,
@@ -176,6 +209,14 @@ protected:
                                     juce::PathStrokeType::EndCapStyle::rounded);
     _graphics.setColour(juce::Colours::white);
     _graphics.strokePath(_path, strokeType);
+
+    const float strokeRight =
+      _path.getBounds().getRight() + strokeType.getStrokeThickness();
+    if (strokeRight > _context.wrapX) [[unlikely]]
+      _graphics.strokePath(
+        _path,
+        strokeType,
+        juce::AffineTransform::translation(-_context.wrapWidth, 0.0f));
   }
 
   //============================================================================
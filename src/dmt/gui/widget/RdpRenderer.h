@@ -0,0 +1,231 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Ramer-Douglas-Peucker oscilloscope renderer. Draws one point per sample like
+ * the PathStrokeRenderer, but simplifies the points before stroking, so
+ * zoomed-in views stroke far fewer segments at the same visual quality.
+ * Based on the proof of concept in test/rdp_test.py.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "gui/widget/OscilloscopeRenderer.h"
+#include <JuceHeader.h>
+#include <vector>
+
+//==============================================================================
+
+namespace dmt {
+namespace gui {
+namespace widget {
+
+//==============================================================================
+/**
+ * @brief Path simplifying oscilloscope renderer.
+ *
+ * @tparam SampleType The sample type (e.g., float, double) used for audio data.
+ *
+ * @details
+ * Collects one point per sample, then removes every point that lies closer
+ * than epsilon to the line through its kept neighbours, using the
+ * Ramer-Douglas-Peucker algorithm. Epsilon is a fraction of a pixel scaled
+ * with the size factor, so the removed detail is never visible.
+ *
+ * This is meant for zoomed-in views with a few samples per pixel, where the
+ * waveform is smooth and most points lie on nearly straight lines. The
+ * algorithm runs iteratively on an explicit stack. The point, flag and stack
+ * buffers as well as the path are kept between frames, so nothing is
+ * allocated once they grew to the largest frame.
+ *
+ * The renderer maintains persistent state (currentX and currentSample) between
+ * frames to ensure visual continuity of the waveform across render calls.
+ */
+template<typename SampleType>
+class RdpRenderer : public OscilloscopeRenderer<SampleType>
+{
+  using Point = juce::Point<float>;
+
+  /** Maximum deviation of the simplified path in unscaled pixels. */
+  constexpr static float EPSILON = 0.2f;
+
+  //============================================================================
+public:
+  using RingBuffer = typename OscilloscopeRenderer<SampleType>::RingBuffer;
+  using RenderContext =
+    typename OscilloscopeRenderer<SampleType>::RenderContext;
+
+  //============================================================================
+  /**
+   * @brief Draws a waveform segment using a simplified path.
+   *
+   * @param _graphics The JUCE Graphics context targeting the oscilloscope
+   *                  image.
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _channel The audio channel index to read from.
+   * @param _context Pre-computed rendering parameters for this frame.
+   */
+  inline void draw(juce::Graphics& _graphics,
+                   RingBuffer& _ringBuffer,
+                   int _channel,
+                   const RenderContext& _context) override
+  {
+    this->currentX = _context.drawStartX;
+    collectPoints(_ringBuffer, _channel, _context);
+
+    const float epsilon = EPSILON * _context.sizeFactor;
+    simplify(epsilon * epsilon);
+
+    path.clear();
+    path.preallocateSpace(3 * static_cast<int>(points.size()));
+    path.startNewSubPath(points.front());
+    for (size_t i = 1; i < points.size(); ++i)
+      if (keep[i])
+        path.lineTo(points[i]);
+
+    this->strokePath(_graphics, path, _context);
+  }
+
+  //============================================================================
+private:
+  //============================================================================
+  /**
+   * @brief Collects one point per sample, starting at the previous frame.
+   *
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _channel The audio channel index to read from.
+   * @param _context Pre-computed rendering parameters for this frame.
+   */
+  inline void collectPoints(RingBuffer& _ringBuffer,
+                            int _channel,
+                            const RenderContext& _context)
+  {
+    points.clear();
+    points.emplace_back(this->currentX,
+                        this->sampleToY(this->currentSample,
+                                        _context.halfHeight,
+                                        _context.amplitude));
+
+    for (int i = 0; i < _context.sampleCount; ++i) {
+      this->currentSample =
+        _ringBuffer.getSample(_channel, _context.firstSampleIndex + i);
+      this->currentX += _context.pixelsPerSample;
+      points.emplace_back(this->currentX,
+                          this->sampleToY(this->currentSample,
+                                          _context.halfHeight,
+                                          _context.amplitude));
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Flags the points that are kept by the simplification.
+   *
+   * @param _squaredEpsilon The squared maximum deviation in pixels.
+   *
+   * @details
+   * Every range on the stack is split at its point furthest from the line
+   * through its ends, as long as that point is further away than epsilon.
+   * The first and last point are always kept.
+   */
+  inline void simplify(const float _squaredEpsilon)
+  {
+    const size_t numPoints = points.size();
+    keep.assign(numPoints, false);
+    keep.front() = true;
+    keep.back() = true;
+
+    stack.clear();
+    stack.push_back({ 0, numPoints - 1 });
+
+    while (!stack.empty()) {
+      const Range range = stack.back();
+      stack.pop_back();
+      if (range.last - range.first < 2)
+        continue;
+
+      const Point start = points[range.first];
+      const Point delta = points[range.last] - start;
+      const float squaredLength = delta.x * delta.x + delta.y * delta.y;
+
+      float maxSquaredDistance = 0.0f;
+      size_t furthest = range.first;
+      for (size_t i = range.first + 1; i < range.last; ++i) {
+        const Point offset = points[i] - start;
+        const float squaredDistance =
+          getSquaredDistance(offset, delta, squaredLength);
+        if (squaredDistance > maxSquaredDistance) {
+          maxSquaredDistance = squaredDistance;
+          furthest = i;
+        }
+      }
+
+      if (maxSquaredDistance > _squaredEpsilon) {
+        keep[furthest] = true;
+        stack.push_back({ range.first, furthest });
+        stack.push_back({ furthest, range.last });
+      }
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the squared distance of a point to a line.
+   *
+   * @param _offset The point relative to the start of the line.
+   * @param _delta The end of the line relative to its start.
+   * @param _squaredLength The squared length of the line.
+   *
+   * @return The squared perpendicular distance, or the squared distance to
+   *         the start if the line has no length.
+   */
+  [[nodiscard]] static inline float getSquaredDistance(
+    const Point _offset,
+    const Point _delta,
+    const float _squaredLength) noexcept
+  {
+    if (_squaredLength <= 0.0f)
+      return _offset.x * _offset.x + _offset.y * _offset.y;
+    const float cross = _delta.x * _offset.y - _delta.y * _offset.x;
+    return cross * cross / _squaredLength;
+  }
+
+  //============================================================================
+  struct Range
+  {
+    size_t first;
+    size_t last;
+  };
+
+  //============================================================================
+  std::vector<Point> points;
+  std::vector<bool> keep;
+  std::vector<Range> stack;
+  juce::Path path;
+};
+
+} // namespace widget
+} // namespace gui
+} // namespace dmt
@@ -34,6 +34,7 @@
 #include "dmt/utility/Scaleable.h"
 #include "utility/Math.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -124,7 +125,7 @@ public:
     : juce::Slider()
     , type(_type)
   {
-    TRACER("RotarySlider::RotarySlider");
+    GUI_TRACER_COMPONENT("RotarySlider::RotarySlider");
     setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
     setTextBoxStyle(juce::Slider::TextBoxBelow, true, 0, 0);
     juce::Random rand;
@@ -146,7 +147,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) override
   {
-    TRACER("RotarySlider::paint");
+    GUI_TRACER_COMPONENT("RotarySlider::paint");
     const auto bounds = getLocalBounds().toFloat();
     const auto padding = rawPadding * size;
 
@@ -166,7 +167,7 @@ public:
    */
   [[nodiscard]] inline Type getType() const noexcept
   {
-    TRACER("RotarySlider::getType");
+    GUI_TRACER_COMPONENT("RotarySlider::getType");
     return type;
   }
 
@@ -212,7 +213,7 @@ protected:
   inline void drawSlider(juce::Graphics& _g,
                          const juce::Rectangle<float>& _bounds) const noexcept
   {
-    TRACER("RotarySlider::drawSlider");
+    GUI_TRACER_COMPONENT("RotarySlider::drawSlider");
     // Draw bounds debug
     _g.setColour(juce::Colours::aqua);
     if (Settings::debugBounds)
@@ -353,7 +354,7 @@ protected:
     const float _endAngleInRadians,
     const float _valueAngleInRadians) const noexcept
   {
-    TRACER("RotarySlider::getUpperRail");
+    GUI_TRACER_COMPONENT("RotarySlider::getUpperRail");
     juce::Path arc;
     switch (this->type) {
       case Type::Selector:
@@ -414,7 +415,7 @@ protected:
     float _startAngleInRadians,
     float _endAngleInRadians) const noexcept
   {
-    TRACER("RotarySlider::getLowerRail");
+    GUI_TRACER_COMPONENT("RotarySlider::getLowerRail");
     juce::Path arc;
     arc.addCentredArc(_centre.getX(),
                       _centre.getY(),
@@ -445,7 +446,7 @@ protected:
     const juce::Point<float>& _centre,
     const float& _angleInRadians) const noexcept
   {
-    TRACER("RotarySlider::getTick");
+    GUI_TRACER_COMPONENT("RotarySlider::getTick");
     const float outerRadius = _bounds.getWidth() / 2.0f;
     const auto outerPoint =
       dmt::math::pointOnCircle(_centre, outerRadius, _angleInRadians);
@@ -0,0 +1,343 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Scanline oscilloscope renderer. Builds the same min/max waveform as the
+ * MinMaxRenderer, but rasterizes it directly into the image as one
+ * anti-aliased vertical span per pixel column instead of stroking a path.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "gui/widget/MinMaxRenderer.h"
+#include <JuceHeader.h>
+#include <limits>
+#include <vector>
+
+//==============================================================================
+
+namespace dmt {
+namespace gui {
+namespace widget {
+
+//==============================================================================
+/**
+ * @brief Oscilloscope renderer that writes vertical spans into the image.
+ *
+ * @tparam SampleType The sample type (e.g., float, double) used for audio data.
+ *
+ * @details
+ * The waveform is built exactly like in MinMaxRenderer, so both renderers
+ * show the same points. Instead of handing the path to JUCE's general
+ * purpose stroker, every pixel column is split into SUBCOLUMNS vertical
+ * spans, and each span gets the exact interval where it crosses the stroke
+ * of the path. The spans are blended into the image through its bitmap
+ * data, with the coverage of every pixel averaged over its spans.
+ *
+ * The stroke has round caps and joins, where JUCE bevels the joins, so the
+ * images only differ at the outside of sharp corners.
+ * src/dmt/test/scanline_test.py compares both rasterizations on test signals
+ * across zoom levels and stroke thicknesses.
+ *
+ * The cost is a single pass over the touched spans and pixels. The buffers
+ * are kept between frames, so no allocation happens once they reached the
+ * image width.
+ *
+ * If the context provides no image, the path is stroked as usual.
+ */
+template<typename SampleType>
+class ScanlineRenderer : public MinMaxRenderer<SampleType>
+{
+  //============================================================================
+public:
+  using RingBuffer = typename MinMaxRenderer<SampleType>::RingBuffer;
+  using RenderContext = typename MinMaxRenderer<SampleType>::RenderContext;
+
+  //============================================================================
+  /**
+   * @brief Draws a waveform segment by rasterizing vertical spans.
+   *
+   * @param _graphics The JUCE Graphics context targeting the oscilloscope
+   *                  image. Only used if the context has no image.
+   * @param _ringBuffer Reference to the ring buffer containing audio samples.
+   * @param _channel The audio channel index to read from.
+   * @param _context Pre-computed rendering parameters for this frame.
+   */
+  inline void draw(juce::Graphics& _graphics,
+                   RingBuffer& _ringBuffer,
+                   int _channel,
+                   const RenderContext& _context) override
+  {
+    this->currentX = _context.drawStartX;
+    const auto path = this->buildMinMaxPath(_ringBuffer, _channel, _context);
+
+    if (_context.image == nullptr) [[unlikely]] {
+      this->strokePath(_graphics, path, _context);
+      return;
+    }
+    rasterize(path, *_context.image, _context);
+  }
+
+  //============================================================================
+private:
+  /** Number of vertical spans per pixel column, for horizontal coverage. */
+  constexpr static int SUBCOLUMNS = 8;
+
+  //============================================================================
+  /**
+   * @brief Rasterizes the path into the image.
+   *
+   * @param _path The waveform path, made of straight lines only.
+   * @param _image The circular image to draw into.
+   * @param _context Pre-computed rendering parameters for this frame.
+   *
+   * @details
+   * Path coordinates are unwrapped, the column at x = 0 lives at the start
+   * of the circular image and columns past the image width are skipped.
+   */
+  inline void rasterize(const juce::Path& _path,
+                        juce::Image& _image,
+                        const RenderContext& _context)
+  {
+    const float radius = 0.5f * _context.thickness * _context.sizeFactor;
+    const int imageWidth = static_cast<int>(_context.wrapWidth);
+    const int originX = imageWidth - static_cast<int>(_context.wrapX);
+    const auto pathBounds = _path.getBounds();
+
+    firstColumn = std::max(
+      static_cast<int>(std::floor(pathBounds.getX() - radius)), 0);
+    const int endColumn = std::min(
+      static_cast<int>(std::ceil(pathBounds.getRight() + radius)) + 1,
+      imageWidth);
+    if (endColumn <= firstColumn)
+      return;
+
+    const size_t numSpans =
+      static_cast<size_t>((endColumn - firstColumn) * SUBCOLUMNS);
+    spanTops.assign(numSpans, std::numeric_limits<float>::max());
+    spanBottoms.assign(numSpans, std::numeric_limits<float>::lowest());
+    traceColumns(_path, radius);
+
+    juce::Image::BitmapData bitmap(_image,
+                                   juce::Image::BitmapData::readWrite);
+    const int height = _image.getHeight();
+    rowCoverage.resize(static_cast<size_t>(height));
+
+    for (int column = firstColumn; column < endColumn; ++column) {
+      const int x = (column + originX) % imageWidth;
+      fillColumn(bitmap, x, column, height);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Collects the extent of the stroke along every span.
+   *
+   * @param _path The waveform path, made of straight lines only.
+   * @param _radius Half the stroke thickness.
+   */
+  inline void traceColumns(const juce::Path& _path,
+                           const float _radius) noexcept
+  {
+    juce::Path::Iterator iterator(_path);
+    float lastX = 0.0f;
+    float lastY = 0.0f;
+
+    while (iterator.next()) {
+      const float x = iterator.x1;
+      const float y = iterator.y1;
+      if (iterator.elementType == juce::Path::Iterator::lineTo)
+        traceSegment(lastX, lastY, x, y, _radius);
+      else
+        traceSegment(x, y, x, y, _radius);
+      lastX = x;
+      lastY = y;
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Adds the stroke around one line to the spans it touches.
+   *
+   * @param _x0 The x position of the first point.
+   * @param _y0 The y position of the first point.
+   * @param _x1 The x position of the second point.
+   * @param _y1 The y position of the second point.
+   * @param _radius Half the stroke thickness.
+   *
+   * @details
+   * The stroke of a line is the set of points within the radius of it, a
+   * rectangle with a round cap at both ends. Every span crosses it in one
+   * interval. Its ends lie either on a cap, at most the radius above and
+   * below the cap center, or on one of the two edges, which run parallel to
+   * the line at the radius times sqrt(1 + slope^2) above and below it. The
+   * caps of neighbouring lines overlap, so they join like round joins.
+   *
+   * Each span sits at the center of its slice of the pixel column.
+   */
+  inline void traceSegment(float _x0,
+                           float _y0,
+                           float _x1,
+                           float _y1,
+                           const float _radius) noexcept
+  {
+    if (_x1 < _x0) {
+      std::swap(_x0, _x1);
+      std::swap(_y0, _y1);
+    }
+
+    const float scale = static_cast<float>(SUBCOLUMNS);
+    const int firstSpan = firstColumn * SUBCOLUMNS;
+    const int endSpan = firstSpan + static_cast<int>(spanTops.size());
+    const int first = std::max(
+      static_cast<int>(std::ceil((_x0 - _radius) * scale - 0.5f)), firstSpan);
+    const int last = std::min(
+      static_cast<int>(std::floor((_x1 + _radius) * scale - 0.5f)),
+      endSpan - 1);
+
+    // Offset from the line to the upper edge, perpendicular to the line
+    const float width = _x1 - _x0;
+    const float height = _y1 - _y0;
+    const float length = std::sqrt(width * width + height * height);
+    const float slope = width > 0.0f ? height / width : 0.0f;
+    const float edgeX = width > 0.0f ? height / length * _radius : 0.0f;
+    const float edgeY = width > 0.0f ? -width / length * _radius : 0.0f;
+    const float radiusSquared = _radius * _radius;
+
+    for (int span = first; span <= last; ++span) {
+      const float x = (static_cast<float>(span) + 0.5f) / scale;
+      float top = std::numeric_limits<float>::max();
+      float bottom = std::numeric_limits<float>::lowest();
+
+      const auto addCap = [&](const float _capX, const float _capY) {
+        const float distance = x - _capX;
+        if (std::abs(distance) > _radius)
+          return;
+        const float extent = std::sqrt(radiusSquared - distance * distance);
+        top = std::min(top, _capY - extent);
+        bottom = std::max(bottom, _capY + extent);
+      };
+      const auto addEdge = [&](const float _offsetX, const float _offsetY) {
+        if (x < _x0 + _offsetX || x > _x1 + _offsetX)
+          return;
+        const float y = _y0 + (x - _offsetX - _x0) * slope + _offsetY;
+        top = std::min(top, y);
+        bottom = std::max(bottom, y);
+      };
+      addCap(_x0, _y0);
+      addCap(_x1, _y1);
+      if (width > 0.0f) {
+        addEdge(edgeX, edgeY);
+        addEdge(-edgeX, -edgeY);
+      }
+      if (top > bottom)
+        continue;
+
+      const size_t index = static_cast<size_t>(span - firstSpan);
+      spanTops[index] = std::min(spanTops[index], top);
+      spanBottoms[index] = std::max(spanBottoms[index], bottom);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Blends the spans of one pixel column into the image in white.
+   *
+   * @param _bitmap The bitmap data of the image.
+   * @param _x The pixel column in the image.
+   * @param _column The pixel column in path coordinates.
+   * @param _height The height of the image.
+   *
+   * @details
+   * Every pixel is covered by the part of each span within its row, averaged
+   * over the spans. The coverage is therefore exact vertically and sampled
+   * SUBCOLUMNS times horizontally, which anti-aliases steep edges as well.
+   */
+  inline void fillColumn(juce::Image::BitmapData& _bitmap,
+                         const int _x,
+                         const int _column,
+                         const int _height) noexcept
+  {
+    const size_t firstIndex =
+      static_cast<size_t>((_column - firstColumn) * SUBCOLUMNS);
+    const size_t endIndex = firstIndex + SUBCOLUMNS;
+
+    float top = std::numeric_limits<float>::max();
+    float bottom = std::numeric_limits<float>::lowest();
+    for (size_t index = firstIndex; index < endIndex; ++index) {
+      top = std::min(top, spanTops[index]);
+      bottom = std::max(bottom, spanBottoms[index]);
+    }
+    if (top > bottom)
+      return;
+
+    const int firstRow = std::max(static_cast<int>(std::floor(top)), 0);
+    const int endRow = std::min(static_cast<int>(std::ceil(bottom)), _height);
+    if (endRow <= firstRow)
+      return;
+
+    std::fill(
+      rowCoverage.begin() + firstRow, rowCoverage.begin() + endRow, 0.0f);
+    for (size_t index = firstIndex; index < endIndex; ++index) {
+      const float spanTop = spanTops[index];
+      const float spanBottom = spanBottoms[index];
+      if (spanTop > spanBottom)
+        continue;
+
+      const int spanFirstRow =
+        std::max(static_cast<int>(std::floor(spanTop)), firstRow);
+      const int spanEndRow =
+        std::min(static_cast<int>(std::ceil(spanBottom)), endRow);
+      for (int y = spanFirstRow; y < spanEndRow; ++y) {
+        const float rowTop = static_cast<float>(y);
+        const float covered =
+          std::min(spanBottom, rowTop + 1.0f) - std::max(spanTop, rowTop);
+        rowCoverage[static_cast<size_t>(y)] += std::clamp(covered, 0.0f, 1.0f);
+      }
+    }
+
+    const float alphaScale = 255.0f / static_cast<float>(SUBCOLUMNS);
+    for (int y = firstRow; y < endRow; ++y) {
+      const auto alpha = static_cast<juce::uint8>(std::min(
+        rowCoverage[static_cast<size_t>(y)] * alphaScale + 0.5f, 255.0f));
+      if (alpha == 0)
+        continue;
+
+      auto* pixel =
+        reinterpret_cast<juce::PixelARGB*>(_bitmap.getPixelPointer(_x, y));
+      pixel->blend(juce::PixelARGB(alpha, alpha, alpha, alpha));
+    }
+  }
+
+  //============================================================================
+  std::vector<float> spanTops;
+  std::vector<float> spanBottoms;
+  std::vector<float> rowCoverage;
+  int firstColumn = 0;
+};
+
+} // namespace widget
+} // namespace gui
+} // namespace dmt
@@ -32,6 +32,7 @@
 
 #include "utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 #include <melatonin_blur/melatonin_blur.h>
 
@@ -101,7 +102,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) override
   {
-    TRACER("Shadow::paint");
+    GUI_TRACER_COMPONENT("Shadow::paint");
 
     if (!visibility)
       return;
@@ -154,7 +155,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("Shadow::resized");
+    GUI_TRACER_COMPONENT("Shadow::resized");
     refreshCachedImageIfNeeded(true);
   }
 
@@ -170,7 +171,7 @@ public:
    */
   inline void setColour(const juce::Colour& _newColour)
   {
-    TRACER("Shadow::setColour");
+    GUI_TRACER_COMPONENT("Shadow::setColour");
     colour = &_newColour;
     needsRepaint = true;
     repaint();
@@ -187,7 +188,7 @@ public:
    */
   inline void setPath(juce::Path _newPath)
   {
-    TRACER("Shadow::setPath");
+    GUI_TRACER_COMPONENT("Shadow::setPath");
     path = _newPath;
     resized();
   }
@@ -207,7 +208,7 @@ public:
    */
   inline void directDraw(juce::Graphics& _g, juce::Path _target)
   {
-    TRACER("Shadow::directDraw");
+    GUI_TRACER_COMPONENT("Shadow::directDraw");
     if (inner)
       drawInnerForPath(_g, _target);
     else
@@ -228,7 +229,7 @@ protected:
    */
   inline void drawInnerForPath(juce::Graphics& _g, juce::Path _target)
   {
-    TRACER("Shadow::drawInnerForPath");
+    GUI_TRACER_COMPONENT("Shadow::drawInnerForPath");
     updateShadowParameters();
     innerShadowRenderer.render(_g, _target);
   }
@@ -246,7 +247,7 @@ protected:
    */
   inline void drawOuterForPath(juce::Graphics& _g, juce::Path _target)
   {
-    TRACER("Shadow::drawOuterForPath");
+    GUI_TRACER_COMPONENT("Shadow::drawOuterForPath");
     juce::Graphics::ScopedSaveState saveState(_g);
     juce::Path shadowPath(_target);
     shadowPath.addRectangle(_target.getBounds().expanded(10.0f));
@@ -35,6 +35,7 @@
 #include "gui/widget/Shadow.h"
 #include "utility/Icon.h"
 #include "utility/Settings.h"
+#include "utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -101,7 +102,7 @@ public:
     , parameterID(_parameterID)
     , apvts(_apvts)
   {
-    TRACER("ToggleButton::ToggleButton");
+    GUI_TRACER_COMPONENT("ToggleButton::ToggleButton");
     // Start listening to the parameter
     apvts.addParameterListener(parameterID, this);
 
@@ -126,7 +127,7 @@ public:
    */
   inline ~ToggleButton() override
   {
-    TRACER("ToggleButton::~ToggleButton");
+    GUI_TRACER_COMPONENT("ToggleButton::~ToggleButton");
     apvts.removeParameterListener(parameterID, this);
   }
 
@@ -143,7 +144,7 @@ public:
    */
   inline void mouseEnter(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("ToggleButton::mouseEnter");
+    GUI_TRACER_COMPONENT("ToggleButton::mouseEnter");
     if (isEnabled()) {
       auto* bypassParameter = apvts.getParameter(parameterID);
       if (bypassParameter != nullptr && bypassParameter->getValue() == 0.0f) {
@@ -164,7 +165,7 @@ public:
    */
   inline void mouseExit(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("ToggleButton::mouseExit");
+    GUI_TRACER_COMPONENT("ToggleButton::mouseExit");
     if (isEnabled()) {
       auto* bypassParameter = apvts.getParameter(parameterID);
       if (bypassParameter != nullptr && bypassParameter->getValue() == 0.0f) {
@@ -182,7 +183,7 @@ public:
    */
   inline void mouseDown(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("ToggleButton::mouseDown");
+    GUI_TRACER_COMPONENT("ToggleButton::mouseDown");
     if (isEnabled()) {
       // No visual state change on mouse down for toggle.
     }
@@ -200,7 +201,7 @@ public:
    */
   inline void mouseUp(const juce::MouseEvent& /*_event*/) override
   {
-    TRACER("ToggleButton::mouseUp");
+    GUI_TRACER_COMPONENT("ToggleButton::mouseUp");
     if (isEnabled()) {
       // Toggle the parameter value
       auto* bypassParameter = apvts.getParameter(parameterID);
@@ -225,7 +226,7 @@ public:
   inline void parameterChanged(const juce::String& _parameterID,
                                float _newValue) override
   {
-    TRACER("ToggleButton::parameterChanged");
+    GUI_TRACER_COMPONENT("ToggleButton::parameterChanged");
     if (_parameterID == parameterID) {
       if (_newValue == 0.0f) {
         setPassiveState();
@@ -32,6 +32,7 @@
 
 #include "dmt/utility/Scaleable.h"
 #include "utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -109,7 +110,7 @@ public:
     , outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
     , innerShadow(drawInnerShadow, innerShadowColour, innerShadowRadius, true)
   {
-    TRACER("TriangleButton::TriangleButton");
+    GUI_TRACER_COMPONENT("TriangleButton::TriangleButton");
     addAndMakeVisible(outerShadow);
     addAndMakeVisible(innerShadow);
   }
@@ -129,7 +130,7 @@ protected:
    */
   [[nodiscard]] inline juce::Path getPath(juce::Rectangle<int> _bounds)
   {
-    TRACER("TriangleButton::getPath");
+    GUI_TRACER_COMPONENT("TriangleButton::getPath");
     juce::Path path;
     const float left = static_cast<float>(_bounds.getX());
     const float right = static_cast<float>(_bounds.getRight());
@@ -185,7 +186,7 @@ protected:
   [[nodiscard]] inline juce::Path getTnnerTrianglePath(
     juce::Rectangle<int> _origin)
   {
-    TRACER("TriangleButton::getTnnerTrianglePath");
+    GUI_TRACER_COMPONENT("TriangleButton::getTnnerTrianglePath");
     if (drawBorder) {
       auto bounds = _origin;
       float width = static_cast<float>(bounds.getWidth());
@@ -209,7 +210,7 @@ protected:
    */
   inline void buttonStateChanged() override
   {
-    TRACER("TriangleButton::buttonStateChanged");
+    GUI_TRACER_COMPONENT("TriangleButton::buttonStateChanged");
     repaint();
   }
 
@@ -232,7 +233,7 @@ protected:
                           bool /*_shouldDrawButtonAsHighlighted*/,
                           bool /*_shouldDrawButtonAsDown*/) override
   {
-    TRACER("TriangleButton::paintButton");
+    GUI_TRACER_COMPONENT("TriangleButton::paintButton");
     const auto bounds = this->getLocalBounds();
     const int bigBoundsPadding = static_cast<int>(buttonMargin * size);
     const auto bigBounds = bounds.reduced(bigBoundsPadding);
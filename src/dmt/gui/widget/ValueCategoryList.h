@@ -35,6 +35,7 @@
 #include "dmt/utility/Fonts.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -77,7 +78,7 @@ public:
     : categories(_categories)
     , onCategorySelected(std::move(_onCategorySelected))
   {
-    TRACER("ValueCategoryList::ValueCategoryList");
+    GUI_TRACER_COMPONENT("ValueCategoryList::ValueCategoryList");
     addCategories();
     onCategorySelected(categories[0]);
     labelList[0]->setFontColour(selectedFontColour);
@@ -88,7 +89,7 @@ public:
 
   void paint(juce::Graphics& _g) override
   {
-    TRACER("ValueCategoryList::paint");
+    GUI_TRACER_COMPONENT("ValueCategoryList::paint");
     _g.setColour(seperatorColour);
 
     // Draw top line
@@ -117,7 +118,7 @@ public:
 
   void resized() override
   {
-    TRACER("ValueCategoryList::resized");
+    GUI_TRACER_COMPONENT("ValueCategoryList::resized");
     const auto fontSize = rawFontSize * size;
     auto bounds = getLocalBounds();
     for (auto& label : labelList) {
@@ -128,7 +129,7 @@ public:
 
   void setOptimalSize(const int width)
   {
-    TRACER("ValueCategoryList::setOptimalSize");
+    GUI_TRACER_COMPONENT("ValueCategoryList::setOptimalSize");
     const auto fontSize = rawFontSize * size;
     const auto neededHeight = fontSize * labelList.size();
     const auto extraHeight = fontSize * 0.5f;
@@ -138,7 +139,7 @@ public:
 protected:
   void addCategories()
   {
-    TRACER("ValueCategoryList::addCategories");
+    GUI_TRACER_COMPONENT("ValueCategoryList::addCategories");
     // Let's clear the current labels
     labelList.clear();
 
@@ -158,7 +159,7 @@ protected:
 
   void addAllLabels()
   {
-    TRACER("ValueCategoryList::addAllLabels");
+    GUI_TRACER_COMPONENT("ValueCategoryList::addAllLabels");
     for (auto& label : labelList) {
       addAndMakeVisible(*label);
       label->addMouseListener(this, true);
@@ -167,7 +168,7 @@ protected:
 
   void mouseUp(const juce::MouseEvent& _event) override
   {
-    TRACER("ValueCategoryList::mouseUp");
+    GUI_TRACER_COMPONENT("ValueCategoryList::mouseUp");
     const auto clickedLabel = dynamic_cast<Lable*>(_event.eventComponent);
 
     if (!clickedLabel)
@@ -40,6 +40,7 @@
 #include "dmt/gui/widget/TextEditor.h"
 #include "dmt/utility/Fonts.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -85,7 +86,7 @@ public:
             juce::Justification::centredLeft)
     , editor(String(leaf.name + "Editor"))
   {
-    TRACER("ValueEditor::ValueEditor");
+    GUI_TRACER_COMPONENT("ValueEditor::ValueEditor");
     addAndMakeVisible(label);
     addAndMakeVisible(editor);
 
@@ -104,7 +105,7 @@ public:
 
   void paint(juce::Graphics& _g) override
   {
-    TRACER("ValueEditor::paint");
+    GUI_TRACER_COMPONENT("ValueEditor::paint");
     if (!editor.hasKeyboardFocus(false)) {
       editor.setText(leaf.toString(), juce::dontSendNotification);
     }
@@ -112,7 +113,7 @@ public:
 
   void resized() override
   {
-    TRACER("ValueEditor::resized");
+    GUI_TRACER_COMPONENT("ValueEditor::resized");
     auto bounds = getLocalBounds();
     auto labelBounds = bounds.removeFromLeft(bounds.getWidth() / 3.0f * 2.0f);
     auto editorBounds = bounds;
@@ -129,7 +130,7 @@ public:
   // TODO: This is absolutely horrible
   void setStyle()
   {
-    TRACER("ValueEditor::setStyle");
+    GUI_TRACER_COMPONENT("ValueEditor::setStyle");
     label.setRawHorizontalPadding(labelHorizontalPadding);
     editor.setColour(juce::TextEditor::textColourId, fontColour);
     editor.setColour(juce::TextEditor::backgroundColourId,
@@ -140,7 +141,7 @@ public:
 
   void newValueCallback()
   {
-    TRACER("ValueEditor::newValueCallback");
+    GUI_TRACER_COMPONENT("ValueEditor::newValueCallback");
     auto newText = editor.getText();
     if (!leaf.parseAndSet(newText)) {
       editor.setText(leaf.toString(), juce::dontSendNotification);
@@ -34,6 +34,7 @@
 #include "dmt/gui/widget/ValueEditor.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -63,7 +64,7 @@ class ValueEditorList
 public:
   ValueEditorList()
   {
-    TRACER("ValueEditorList::ValueEditorList");
+    GUI_TRACER_COMPONENT("ValueEditorList::ValueEditorList");
     addAllEditors();
   }
 
@@ -71,7 +72,7 @@ public:
 
   void paint(juce::Graphics& _g) override
   {
-    TRACER("ValueEditorList::paint");
+    GUI_TRACER_COMPONENT("ValueEditorList::paint");
 
     _g.setColour(seperatorColour);
 
@@ -101,7 +102,7 @@ public:
 
   void resized() override
   {
-    TRACER("ValueEditorList::resized");
+    GUI_TRACER_COMPONENT("ValueEditorList::resized");
 
     const auto fontSize = rawFontSize * size;
 
@@ -114,7 +115,7 @@ public:
 
   void setOptimalSize(const int width)
   {
-    TRACER("ValueEditorList::setOptimalSize");
+    GUI_TRACER_COMPONENT("ValueEditorList::setOptimalSize");
 
     const auto fontSize = rawFontSize * size;
     const auto neededHeight = fontSize * editorList.size();
@@ -124,7 +125,7 @@ public:
 
   void setCategory(TreeAdapter::Category& _category)
   {
-    TRACER("ValueEditorList::setCategory");
+    GUI_TRACER_COMPONENT("ValueEditorList::setCategory");
 
     // Check if the category is the same as the current one
     if (category != nullptr && category->name == _category.name)
@@ -156,7 +157,7 @@ public:
 protected:
   void addAllEditors()
   {
-    TRACER("ValueEditorList::addAllEditors");
+    GUI_TRACER_COMPONENT("ValueEditorList::addAllEditors");
 
     for (size_t i = 0; i < editorList.size(); ++i) {
       auto& editor = editorList[i];
@@ -36,6 +36,7 @@
 #include "dmt/utility/RepaintTimer.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -168,8 +169,9 @@ public:
    * non-interactive overlays.
    */
   inline Alerts() noexcept
+    : dmt::utility::RepaintTimer(static_cast<juce::Component&>(*this))
   {
-    TRACER("Alerts::Alerts");
+    GUI_TRACER_COMPONENT("Alerts::Alerts");
     setInterceptsMouseClicks(false, false);
     startRepaintTimer();
   }
@@ -193,7 +195,7 @@ public:
                         AlertType _type,
                         const juce::String _iconName = {}) noexcept
   {
-    TRACER("Alerts::pushAlert");
+    GUI_TRACER_COMPONENT("Alerts::pushAlert");
     // When we push a new alert, let old ones age quicker
     const auto quickAgeTarget = maxAge - fadeOutTime;
     for (int i = 0; i < static_cast<int>(alerts.size()); ++i)
@@ -216,7 +218,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("Alerts::resized");
+    GUI_TRACER_COMPONENT("Alerts::resized");
     // Re-render all alert images on resize
     for (int i = 0; i < static_cast<int>(alerts.size()); ++i)
       renderAlertToImage(alerts.getReference(i));
@@ -235,7 +237,7 @@ public:
    */
   inline void paint(juce::Graphics& _g) override
   {
-    TRACER("Alerts::paint");
+    GUI_TRACER_COMPONENT("Alerts::paint");
     if (alerts.size() == 0)
       return;
 
@@ -283,7 +285,7 @@ public:
    */
   inline void repaintTimerCallback() noexcept override
   {
-    TRACER("Alerts::repaintTimerCallback");
+    GUI_TRACER_COMPONENT("Alerts::repaintTimerCallback");
     for (int i = static_cast<int>(alerts.size()); --i >= 0;) {
       alerts.getReference(i).age += Settings::framerate / 1000.0f;
       if (alerts.getReference(i).age >= maxAge)
@@ -293,6 +295,15 @@ public:
       repaint();
   }
 
+  //==============================================================================
+  /**
+   * @brief Checks whether any alert is left to age.
+   */
+  [[nodiscard]] inline bool hasPendingFrame() const noexcept override
+  {
+    return alerts.size() > 0;
+  }
+
 protected:
   //==============================================================================
   /**
@@ -306,7 +317,7 @@ protected:
    */
   inline void renderAlertToImage(AlertData& _alert)
   {
-    TRACER("Alerts::renderAlertToImage");
+    GUI_TRACER_COMPONENT("Alerts::renderAlertToImage");
 
     const auto alertWidth = rawAlertWidth * size;
     const auto alertHeight = rawAlertHeight * size;
@@ -39,7 +39,10 @@
 #include "dmt/gui/window/Layout.h"
 #include "dmt/gui/window/Popover.h"
 #include "dmt/gui/window/Tooltip.h"
+#include "dmt/utility/FrameScheduler.h"
+#include "dmt/utility/LoadMeter.h"
 #include "dmt/utility/Scaleable.h"
+#include "dmt/utility/Tracer.h"
 #include "dmt/version/Info.h"
 #include <JuceHeader.h>
 
@@ -57,6 +60,9 @@ namespace window {
  * that the UI remains responsive and intuitive while adhering to real-time
  * performance constraints.
  *
+ * It also hosts the frame scheduler of the editor, so every animated
+ * component inside it is ticked from the vertical blank of the display.
+ *
  * @note This class is designed to be used as a top-level component within a
  *       DMT-based application.
  *
@@ -70,6 +76,7 @@ class Compositor
   , public dmt::gui::component::ValueEditor::Listener
   , public dmt::Scaleable<Compositor>
   , public juce::ComponentListener
+  , public dmt::utility::FrameScheduler
 {
   //============================================================================
   // Aliases for convenience
@@ -84,6 +91,7 @@ class Compositor
   using Tooltip = dmt::gui::window::Tooltip;
   using Alerts = dmt::gui::window::Alerts;
   using Layout = dmt::gui::window::Layout;
+  using LoadMeter = dmt::utility::LoadMeter;
 
   //============================================================================
   // Window
@@ -102,21 +110,24 @@ public:
    * @param _mainLayout The main layout to manage within the window.
    * @param _apvts The audio processor value tree state for parameter
    * management.
+   * @param _loadMeter The load meter of the processor, shown in the settings.
    */
   Compositor(String _titleText,
              Layout& _mainLayout,
              AudioProcessorValueTreeState& _apvts,
              Properties& _properties,
+             const LoadMeter& _loadMeter,
              const float& _sizeFactor) noexcept
     : juce::Component("Compositor")
+    , dmt::utility::FrameScheduler(static_cast<juce::Component&>(*this))
     , mainLayout(_mainLayout)
     , properties(_properties)
     , header(_titleText, _apvts)
-    , settingsPanel()
+    , settingsPanel(_loadMeter)
     , borderButton()
     , sizeFactor(_sizeFactor)
   {
-    TRACER("Compositor::Compositor");
+    GUI_TRACER_COMPONENT("Compositor::Compositor");
     // Header
     addAndMakeVisible(header);
     header.getSettingsButton().onClick = [this] { settingsCallback(); };
@@ -165,7 +176,7 @@ public:
   /** @brief Paints the component. */
   void paint(juce::Graphics& /*_g*/) noexcept override
   {
-    TRACER("Compositor::paint");
+    GUI_TRACER_BLOCK("Compositor::paint");
   }
 
   //============================================================================
@@ -177,7 +188,7 @@ public:
    */
   void resized() noexcept override
   {
-    TRACER("Compositor::resized");
+    GUI_TRACER_COMPONENT("Compositor::resized");
     propagateSizeFactor();
     const auto bounds = getLocalBounds();
 
@@ -239,7 +250,7 @@ public:
    */
   void settingsCallback() noexcept
   {
-    TRACER("Compositor::settingsCallback");
+    GUI_TRACER_COMPONENT("Compositor::settingsCallback");
     if (settingsPanel.isVisible())
       return;
 
@@ -272,7 +283,7 @@ public:
    */
   void settingExitCallback() noexcept
   {
-    TRACER("Compositor::settingExitCallback");
+    GUI_TRACER_COMPONENT("Compositor::settingExitCallback");
     if (!settingsPanel.isVisible())
       return;
 
@@ -313,7 +324,7 @@ public:
    */
   void updateCallback() noexcept
   {
-    TRACER("Compositor::updateCallback");
+    GUI_TRACER_COMPONENT("Compositor::updateCallback");
     // Check if update system is disabled
     if (DMT_DISABLE_UPDATE_NOTIFICATION)
       return;
@@ -340,7 +351,7 @@ public:
    */
   void hideHeaderCallback() noexcept
   {
-    TRACER("Compositor::hideHeaderCallback");
+    GUI_TRACER_COMPONENT("Compositor::hideHeaderCallback");
     if (!header.isVisible())
       return;
 
@@ -364,7 +375,7 @@ public:
    */
   void showHeaderCallback() noexcept
   {
-    TRACER("Compositor::showHeaderCallback");
+    GUI_TRACER_COMPONENT("Compositor::showHeaderCallback");
     if (header.isVisible())
       return;
 
@@ -387,7 +398,7 @@ public:
    */
   void saveSettingsCallback() noexcept
   {
-    TRACER("Compositor::saveSettingsCallback");
+    GUI_TRACER_COMPONENT("Compositor::saveSettingsCallback");
     properties.saveCurrentSettings();
     alerts.pushAlert("Settings saved successfully!",
                      "Your settings have been saved.",
@@ -406,7 +417,7 @@ public:
    */
   void resetSettingsCallback() noexcept
   {
-    TRACER("Compositor::resetSettingsCallback");
+    GUI_TRACER_COMPONENT("Compositor::resetSettingsCallback");
     properties.resetToFallback();
 
     propagateSizeFactor();
@@ -441,7 +452,7 @@ public:
    */
   void timerCallback() override
   {
-    TRACER("Compositor::timerCallback");
+    GUI_TRACER_COMPONENT("Compositor::timerCallback");
     if (DMT_DISABLE_UPDATE_NOTIFICATION) {
       stopTimer();
       return;
@@ -464,7 +475,7 @@ public:
    */
   void valueEditorListenerCallback() override
   {
-    TRACER("Compositor::valueEditorListenerCallback");
+    GUI_TRACER_COMPONENT("Compositor::valueEditorListenerCallback");
     propagateSizeFactor();
     resizedRecursively(this);
   }
@@ -483,7 +494,7 @@ public:
    */
   void showUpdatePopover() noexcept
   {
-    TRACER("Compositor::showUpdatePopover");
+    GUI_TRACER_COMPONENT("Compositor::showUpdatePopover");
     if (DMT_DISABLE_UPDATE_NOTIFICATION)
       return;
 
@@ -517,7 +528,7 @@ public:
    */
   void showUpdateButton() noexcept
   {
-    TRACER("Compositor::showUpdateButton");
+    GUI_TRACER_COMPONENT("Compositor::showUpdateButton");
     if (DMT_DISABLE_UPDATE_NOTIFICATION)
       return;
 
@@ -545,7 +556,7 @@ public:
    */
   void setHeaderVisibilityCallback(std::function<void(bool)> callback) noexcept
   {
-    TRACER("Compositor::setHeaderVisibilityCallback");
+    GUI_TRACER_COMPONENT("Compositor::setHeaderVisibilityCallback");
     headerVisibilityCallback = std::move(callback);
   }
 
@@ -557,7 +568,7 @@ public:
    */
   [[nodiscard]] bool isHeaderVisible() const noexcept
   {
-    TRACER("Compositor::isHeaderVisible");
+    GUI_TRACER_COMPONENT("Compositor::isHeaderVisible");
     return header.isVisible();
   }
 
@@ -579,7 +590,7 @@ public:
    */
   void propagateSizeFactor(const bool force = false) noexcept
   {
-    TRACER("Compositor::propagateSizeFactor");
+    GUI_TRACER_COMPONENT("Compositor::propagateSizeFactor");
     if (isPropagatingSizeFactor)
       return;
 
@@ -611,7 +622,7 @@ protected:
    */
   void resizedRecursively(juce::Component* component)
   {
-    TRACER("Compositor::resizedRecursively");
+    GUI_TRACER_COMPONENT("Compositor::resizedRecursively");
     if (component == nullptr)
       return;
 
@@ -640,7 +651,7 @@ protected:
    */
   void setSizeFactorRecursively(juce::Component* component) noexcept
   {
-    TRACER("Compositor::setSizeFactorRecursively");
+    GUI_TRACER_COMPONENT("Compositor::setSizeFactorRecursively");
     if (component == nullptr)
       return;
 
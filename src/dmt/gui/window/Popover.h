@@ -41,6 +41,7 @@
 #include "dmt/utility/Math.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -128,7 +129,7 @@ public:
                    juce::Justification::topLeft,
                    true)
   {
-    TRACER("Popover::Popover");
+    GUI_TRACER_COMPONENT("Popover::Popover");
     setAlwaysOnTop(true);
     setInterceptsMouseClicks(false, true);
 
@@ -145,7 +146,7 @@ public:
   /** @brief Destructor for `Popover`. */
   ~Popover() noexcept override
   {
-    TRACER("Popover::~Popover");
+    GUI_TRACER_COMPONENT("Popover::~Popover");
     setVisible(false);
   }
 
@@ -160,7 +161,7 @@ public:
    */
   void paint(juce::Graphics& _g) noexcept override
   {
-    TRACER("Popover::paint");
+    GUI_TRACER_COMPONENT("Popover::paint");
     // Skip drawing if the anchor is null
     if (normalizedAnchor == nullptr)
       return;
@@ -197,7 +198,7 @@ public:
    */
   [[nodiscard]] bool hitTest(int _x, int _y) noexcept override
   {
-    TRACER("Popover::hitTest");
+    GUI_TRACER_COMPONENT("Popover::hitTest");
     return cachedMessageBounds.contains(_x, _y);
   }
 
@@ -210,7 +211,7 @@ public:
    */
   void resized() noexcept override
   {
-    TRACER("Popover::resized");
+    GUI_TRACER_COMPONENT("Popover::resized");
     cachedMessageBounds = createMessageBounds(false);
 
     const auto closeButtonSize = static_cast<int>(rawCloseButtonSize * size);
@@ -247,7 +248,7 @@ public:
                    juce::String _title,
                    juce::String _message) noexcept
   {
-    TRACER("Popover::showMessage");
+    GUI_TRACER_COMPONENT("Popover::showMessage");
     setNormalizedAnchor(_anchor);
     cachedMessageBounds = createMessageBounds(false); // Update cached bounds
     setVisible(true);
@@ -261,7 +262,7 @@ public:
   /** @brief Hides the popover message. */
   void hideMessage() noexcept
   {
-    TRACER("Popover::hideMessage");
+    GUI_TRACER_COMPONENT("Popover::hideMessage");
     normalizedAnchor.reset();
     this->setVisible(false);
   }
@@ -279,7 +280,7 @@ protected:
    */
   [[nodiscard]] juce::Path createPath(bool isOuter = true) const noexcept
   {
-    TRACER("Popover::createPath");
+    GUI_TRACER_COMPONENT("Popover::createPath");
     juce::Path path;
 
     const auto messageBounds = createMessageBounds(isOuter);
@@ -304,7 +305,7 @@ protected:
    */
   [[nodiscard]] Rectangle createMessageBounds(bool isOuter) const noexcept
   {
-    TRACER("Popover::createMessageBounds");
+    GUI_TRACER_COMPONENT("Popover::createMessageBounds");
     const int surfaceWidth = static_cast<int>(rawSurfaceWidth * size);
     const int surfaceHeight = static_cast<int>(rawSurfaceHeight * size);
     const float borderWidth = isOuter ? 0.0f : rawBorderWidth * size;
@@ -338,7 +339,7 @@ protected:
     tuple<juce::Point<float>, juce::Point<float>, juce::Point<float>>
     calculateSpikePoints(bool isOuter) const noexcept
   {
-    TRACER("Popover::calculateSpikePoints");
+    GUI_TRACER_COMPONENT("Popover::calculateSpikePoints");
     const int spikeWidth = static_cast<int>(rawSpikeWidth * size);
     const int spikeHeight = static_cast<int>(rawSpikeHeight * size);
     const float borderWidth = isOuter ? 0.0f : rawBorderWidth * size;
@@ -413,7 +414,7 @@ protected:
                      juce::Point<float>,
                      juce::Point<float>>& spikePoints) const noexcept
   {
-    TRACER("Popover::addSpikeToPath");
+    GUI_TRACER_COMPONENT("Popover::addSpikeToPath");
     const auto& [spikeTip, spikeBaseLeft, spikeBaseRight] = spikePoints;
 
     path.startNewSubPath(spikeBaseLeft);
@@ -436,7 +437,7 @@ protected:
                                  const Rectangle& messageBounds,
                                  bool isOuter) const noexcept
   {
-    TRACER("Popover::addRoundedRectangleToPath");
+    GUI_TRACER_COMPONENT("Popover::addRoundedRectangleToPath");
     const auto topLeft = messageBounds.getTopLeft().toFloat();
     const auto topRight = messageBounds.getTopRight().toFloat();
     const auto bottomLeft = messageBounds.getBottomLeft().toFloat();
@@ -501,7 +502,7 @@ protected:
    */
   void setNormalizedAnchor(const juce::Point<int>& _anchor) noexcept
   {
-    TRACER("Popover::setNormalizedAnchor");
+    GUI_TRACER_COMPONENT("Popover::setNormalizedAnchor");
     if (getWidth() == 0 || getHeight() == 0)
       return;
 
@@ -522,7 +523,7 @@ protected:
    */
   [[nodiscard]] juce::Point<int> getAnchor() const noexcept
   {
-    TRACER("Popover::getAnchor");
+    GUI_TRACER_COMPONENT("Popover::getAnchor");
     if (normalizedAnchor == nullptr)
       return juce::Point<int>(0, 0);
 
@@ -35,6 +35,7 @@
 #include "dmt/utility/RepaintTimer.h"
 #include "dmt/utility/Scaleable.h"
 #include "dmt/utility/Settings.h"
+#include "dmt/utility/Tracer.h"
 #include <JuceHeader.h>
 
 //==============================================================================
@@ -98,10 +99,11 @@ public:
    * are not intercepted to allow interaction with underlying components.
    */
   inline Tooltip() noexcept
-    : outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
+    : dmt::utility::RepaintTimer(static_cast<juce::Component&>(*this))
+    , outerShadow(drawOuterShadow, outerShadowColour, outerShadowRadius, false)
     , innerShadow(drawInnerShadow, innerShadowColour, innerShadowRadius, true)
   {
-    TRACER("Tooltip::Tooltip");
+    GUI_TRACER_COMPONENT("Tooltip::Tooltip");
     setInterceptsMouseClicks(false, false);
     startRepaintTimer();
   }
@@ -122,7 +124,7 @@ public:
    */
   inline void resized() override
   {
-    TRACER("Tooltip::resized");
+    GUI_TRACER_COMPONENT("Tooltip::resized");
     if (!tooltipImage.isNull())
       renderTooltipImage(currentTooltipText);
   }
@@ -139,7 +141,7 @@ public:
    */
   inline void paint(juce::Graphics& _graphics) override
   {
-    TRACER("Tooltip::paint");
+    GUI_TRACER_COMPONENT("Tooltip::paint");
     if (!tooltipImage.isNull()) {
 
       const int imageWidth = tooltipImage.getWidth();
@@ -183,7 +185,7 @@ public:
    */
   inline void repaintTimerCallback() noexcept override
   {
-    TRACER("Tooltip::repaintTimerCallback");
+    GUI_TRACER_COMPONENT("Tooltip::repaintTimerCallback");
     // Get the parent component of the tooltip
     auto* parent = getParentComponent();
     if (!parent)
@@ -233,6 +235,21 @@ public:
       repaint();
   }
 
+  //==============================================================================
+  /**
+   * @brief Checks whether the tooltip has to follow the mouse.
+   *
+   * @details
+   * The hierarchy only needs to be searched while the mouse is over the
+   * window, or while a tooltip is still shown and has to be hidden.
+   */
+  [[nodiscard]] inline bool hasPendingFrame() const noexcept override
+  {
+    const auto* parent = getParentComponent();
+    return currentTooltipText.isNotEmpty() ||
+           (parent != nullptr && parent->isMouseOver(true));
+  }
+
 protected:
   //==============================================================================
   /**
@@ -247,7 +264,7 @@ protected:
    */
   inline void renderTooltipImage(const juce::String& _text)
   {
-    TRACER("Tooltip::renderTooltipImage");
+    GUI_TRACER_COMPONENT("Tooltip::renderTooltipImage");
 
     // Font size and style
     const auto fontSize = rawFontSize * size;
@@ -0,0 +1,193 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Regression benchmark for the cursor bookkeeping of RingAudioBuffer. It
+ * times writing and consuming blocks with the 64-bit cursors against a copy of
+ * the previous int position scheme, which scanned every written sample for
+ * overruns. Configure with -DDMT_BUILD_BENCHMARKS=ON to build it.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#include "dsp/data/RingAudioBuffer.h"
+#include <JuceHeader.h>
+#include <cstdio>
+#include <vector>
+
+//==============================================================================
+
+namespace {
+
+constexpr int NUM_CHANNELS = 2;
+constexpr int BUFFER_SIZE = 4096;
+constexpr int NUM_ITERATIONS = 200000;
+constexpr int BLOCK_SIZES[] = { 64, 512, 2048 };
+
+//==============================================================================
+/**
+ * @brief The int position scheme RingAudioBuffer used before the cursors.
+ *
+ * @details
+ * Only the bookkeeping is kept, the samples themselves are never touched by
+ * either scheme in this benchmark.
+ */
+class LegacyPositions
+{
+public:
+  //============================================================================
+  LegacyPositions(const int _numChannels, const int _numSamples) noexcept
+    : numSamples(_numSamples)
+    , readPositions(static_cast<size_t>(_numChannels), 0)
+  {
+  }
+
+  //============================================================================
+  void updateWritePosition(const int _increment) noexcept
+  {
+    bool moveWriteOverRead = false;
+    int newWritePosition = (writePosition + _increment) % numSamples;
+    if (writePosition == readPositions[0]) [[unlikely]] {
+      writePosition = newWritePosition;
+      return;
+    }
+
+    for (size_t channel = 0; channel < readPositions.size(); ++channel) {
+      for (size_t i = 0; i < static_cast<size_t>(_increment); ++i) {
+        if ((writePosition + static_cast<int>(i)) % numSamples ==
+            readPositions[channel]) [[unlikely]] {
+          moveWriteOverRead = true;
+          break;
+        }
+      }
+    }
+    writePosition = newWritePosition;
+
+    if (moveWriteOverRead) {
+      for (size_t channel = 0; channel < readPositions.size(); ++channel)
+        readPositions[channel] = writePosition;
+    }
+  }
+
+  //============================================================================
+  int getReadPosition(const int _channel) const noexcept
+  {
+    const int rawReadPosition = readPositions[static_cast<size_t>(_channel)];
+    if (rawReadPosition > writePosition) [[likely]]
+      return rawReadPosition - writePosition;
+    return numSamples - writePosition + rawReadPosition;
+  }
+
+  //============================================================================
+  void incrementReadPosition(const int _channel, const int _increment) noexcept
+  {
+    auto& readPosition = readPositions[static_cast<size_t>(_channel)];
+    readPosition = (readPosition + _increment) % numSamples;
+  }
+
+  //============================================================================
+  void equalizeReadPositions() noexcept
+  {
+    int highestReadPosition = 0;
+    int highestReadChannel = 0;
+    for (size_t channel = 0; channel < readPositions.size(); ++channel) {
+      const int readPos = getReadPosition(static_cast<int>(channel));
+      if (readPos > highestReadPosition) [[likely]] {
+        highestReadPosition = readPos;
+        highestReadChannel = static_cast<int>(channel);
+      }
+    }
+
+    const int highestRawReadPosition =
+      readPositions[static_cast<size_t>(highestReadChannel)];
+    for (auto& readPosition : readPositions)
+      readPosition = highestRawReadPosition;
+  }
+
+  //============================================================================
+  int getNumSamples() const noexcept { return numSamples; }
+
+private:
+  const int numSamples;
+  int writePosition = 0;
+  std::vector<int> readPositions;
+};
+
+//==============================================================================
+/**
+ * @brief Exposes the cursor update of RingAudioBuffer to the benchmark.
+ */
+class CursorPositions : public dmt::dsp::data::RingAudioBuffer<float>
+{
+public:
+  using RingAudioBuffer::RingAudioBuffer;
+  using RingAudioBuffer::updateWritePosition;
+};
+
+//==============================================================================
+/**
+ * @brief Writes blocks and lets every channel consume like an oscilloscope.
+ *
+ * @details
+ * Every channel reads half of what it hasn't read yet, then the channels are
+ * equalized. That keeps the readers behind the writer, so the overrun check
+ * of the old scheme has to scan every written sample.
+ *
+ * @return The average time per block in nanoseconds.
+ */
+template<typename Positions>
+double run(Positions& _positions, const int _blockSize, int64_t& _checksum)
+{
+  const auto start = juce::Time::getHighResolutionTicks();
+  for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+    _positions.updateWritePosition(_blockSize);
+    for (int channel = 0; channel < NUM_CHANNELS; ++channel) {
+      const int unread = _positions.getNumSamples() -
+                         _positions.getReadPosition(channel);
+      _positions.incrementReadPosition(channel, unread / 2);
+    }
+    _positions.equalizeReadPositions();
+    _checksum += _positions.getReadPosition(0);
+  }
+  const auto ticks = juce::Time::getHighResolutionTicks() - start;
+  return juce::Time::highResolutionTicksToSeconds(ticks) * 1e9 /
+         static_cast<double>(NUM_ITERATIONS);
+}
+
+} // namespace
+
+//==============================================================================
+int main()
+{
+  int64_t checksum = 0;
+  std::printf("%10s %14s %14s %9s\n", "block", "int (ns)", "cursor (ns)",
+              "speedup");
+  for (const int blockSize : BLOCK_SIZES) {
+    LegacyPositions legacy(NUM_CHANNELS, BUFFER_SIZE);
+    CursorPositions cursors(NUM_CHANNELS, BUFFER_SIZE);
+    const double legacyTime = run(legacy, blockSize, checksum);
+    const double cursorTime = run(cursors, blockSize, checksum);
+    std::printf("%10d %14.1f %14.1f %8.1fx\n", blockSize, legacyTime,
+                cursorTime, legacyTime / cursorTime);
+  }
+  std::printf("checksum %lld\n", static_cast<long long>(checksum));
+  return 0;
+}
@@ -0,0 +1,153 @@
+#===============================================================================
+# Parity check of the ScanlineRenderer against the stroked MinMaxRenderer path.
+# Both renderers build the same min/max path, so only the rasterization is
+# compared. The reference is the exact stroke of the path with round joins,
+# supersampled SUPERSAMPLING^2 times per pixel. JUCE strokes with beveled
+# joins, which only differ at the outside of sharp corners. The scanline
+# rasterizer is a port of ScanlineRenderer, which crosses the stroke with
+# SUBCOLUMNS vertical spans per pixel column. Coverage is compared per pixel,
+# and the script fails if any case exceeds the tolerances below.
+import math
+import sys
+import numpy as np
+#===============================================================================
+WIDTH = 400
+HEIGHT = 120
+AMPLITUDE = 0.8
+SUPERSAMPLING = 16
+SUBCOLUMNS = 8
+THICKNESSES = [1.0, 3.0, 6.0]
+SAMPLES_PER_PIXEL = [0.25, 1.0, 4.0, 64.0]
+# Tolerances on the coverage difference, 1.0 being a fully covered pixel
+MAX_MEAN_DIFFERENCE = 0.01
+MAX_COVERED_DIFFERENCE = 0.05
+#===============================================================================
+def generate_signals(num_samples):
+    t = np.arange(num_samples, dtype=np.float64)
+    rng = np.random.default_rng(420)
+    return {
+        "sine": np.sin(2.0 * math.pi * t / 97.0),
+        "chirp": np.sin(2.0 * math.pi * t * t / (8.0 * num_samples)),
+        "square": np.sign(np.sin(2.0 * math.pi * t / 211.0)),
+        "noise": rng.uniform(-1.0, 1.0, num_samples),
+    }
+#===============================================================================
+def sample_to_y(sample):
+    half_height = HEIGHT // 2
+    return half_height + sample * half_height * AMPLITUDE
+# Port of MinMaxRenderer::buildPath() for a single frame starting at x = 0
+def build_min_max_path(samples, pixels_per_sample):
+    samples_per_pixel = 1.0 / pixels_per_sample
+    points = [(0.0, sample_to_y(0.0))]
+    first = 0
+    while first < len(samples):
+        first_x = (first + 1) * pixels_per_sample
+        column = math.floor(first_x)
+        next_column = math.ceil((column + 1.0) * samples_per_pixel - 1.0)
+        end = int(min(max(next_column, first + 1), len(samples)))
+        span = samples[first:end]
+        min_index = int(np.argmin(span))
+        max_index = int(np.argmax(span))
+        bin_x = min(end * pixels_per_sample, column + 0.5)
+        min_y = sample_to_y(span[min_index])
+        max_y = sample_to_y(span[max_index])
+        if end - first == 1:
+            points.append((bin_x, min_y))
+        elif min_index <= max_index:
+            points += [(bin_x, min_y), (bin_x, max_y)]
+        else:
+            points += [(bin_x, max_y), (bin_x, min_y)]
+        first = end
+    return points
+#===============================================================================
+# Supersampled coverage of all points within the radius of the path
+def rasterize_reference(points, radius):
+    scale = SUPERSAMPLING
+    inside = np.zeros((HEIGHT * scale, WIDTH * scale), dtype=bool)
+    offsets = (np.arange(WIDTH * scale) + 0.5) / scale
+    for (x0, y0), (x1, y1) in zip(points[:-1], points[1:]):
+        left = max(int((min(x0, x1) - radius) * scale), 0)
+        right = min(int((max(x0, x1) + radius) * scale) + 2, WIDTH * scale)
+        top = max(int((min(y0, y1) - radius) * scale), 0)
+        bottom = min(int((max(y0, y1) + radius) * scale) + 2, HEIGHT * scale)
+        if left >= right or top >= bottom:
+            continue
+        px = offsets[left:right][np.newaxis, :]
+        py = offsets[top:bottom][:, np.newaxis]
+        dx, dy = x1 - x0, y1 - y0
+        length = dx * dx + dy * dy
+        t = 0.0 if length == 0.0 else ((px - x0) * dx + (py - y0) * dy) / length
+        t = np.clip(t, 0.0, 1.0)
+        distance = np.hypot(px - (x0 + t * dx), py - (y0 + t * dy))
+        inside[top:bottom, left:right] |= distance <= radius
+    return inside.reshape(HEIGHT, scale, WIDTH, scale).mean(axis=(1, 3))
+#===============================================================================
+# Port of ScanlineRenderer::traceSegment(), the interval where the vertical
+# line at x crosses the stroke of one line of the path
+def stroke_interval(x, x0, y0, x1, y1, radius):
+    top, bottom = math.inf, -math.inf
+    for cap_x, cap_y in ((x0, y0), (x1, y1)):
+        distance = x - cap_x
+        if abs(distance) <= radius:
+            extent = math.sqrt(radius * radius - distance * distance)
+            top, bottom = min(top, cap_y - extent), max(bottom, cap_y + extent)
+    width, height = x1 - x0, y1 - y0
+    if width > 0.0:
+        length = math.hypot(width, height)
+        edge_x, edge_y = height / length * radius, -width / length * radius
+        for offset_x, offset_y in ((edge_x, edge_y), (-edge_x, -edge_y)):
+            if x0 + offset_x <= x <= x1 + offset_x:
+                y = y0 + (x - offset_x - x0) * height / width + offset_y
+                top, bottom = min(top, y), max(bottom, y)
+    return top, bottom
+# Port of ScanlineRenderer::rasterize() and fillColumn()
+def rasterize_scanline(points, radius):
+    tops = np.full(WIDTH * SUBCOLUMNS, np.inf)
+    bottoms = np.full(WIDTH * SUBCOLUMNS, -np.inf)
+    segments = [(points[0], points[0])] + list(zip(points[:-1], points[1:]))
+    for (x0, y0), (x1, y1) in segments:
+        if x1 < x0:
+            x0, y0, x1, y1 = x1, y1, x0, y0
+        first = max(math.ceil((x0 - radius) * SUBCOLUMNS - 0.5), 0)
+        last = min(math.floor((x1 + radius) * SUBCOLUMNS - 0.5),
+                   WIDTH * SUBCOLUMNS - 1)
+        for span in range(first, last + 1):
+            x = (span + 0.5) / SUBCOLUMNS
+            top, bottom = stroke_interval(x, x0, y0, x1, y1, radius)
+            tops[span] = min(tops[span], top)
+            bottoms[span] = max(bottoms[span], bottom)
+
+    coverage = np.zeros((HEIGHT, WIDTH))
+    for span in range(WIDTH * SUBCOLUMNS):
+        top, bottom = tops[span], bottoms[span]
+        if top > bottom:
+            continue
+        for y in range(max(math.floor(top), 0), min(math.ceil(bottom), HEIGHT)):
+            covered = min(bottom, y + 1.0) - max(top, y)
+            coverage[y, span // SUBCOLUMNS] += min(max(covered, 0.0), 1.0)
+    return np.round(coverage / SUBCOLUMNS * 255) / 255
+#===============================================================================
+def compare(name, samples, pixels_per_sample, thickness):
+    points = build_min_max_path(samples, pixels_per_sample)
+    radius = 0.5 * thickness
+    reference = rasterize_reference(points, radius)
+    scanline = rasterize_scanline(points, radius)
+    difference = np.abs(reference - scanline)
+    covered = np.maximum(reference, scanline) > 0.0
+    mean = difference[covered].mean() if covered.any() else 0.0
+    total = difference.mean()
+    passed = total <= MAX_MEAN_DIFFERENCE and mean <= MAX_COVERED_DIFFERENCE
+    print(f"{name:6} spp={1.0 / pixels_per_sample:6.2f} "
+          f"thickness={thickness:3.1f}  mean={total:.4f}  "
+          f"covered mean={mean:.4f}  max={difference.max():.3f}  "
+          f"{'ok' if passed else 'FAILED'}")
+    return passed
+#===============================================================================
+# Main
+passed = True
+for samples_per_pixel in SAMPLES_PER_PIXEL:
+    num_samples = int(WIDTH * samples_per_pixel) - 1
+    for name, samples in generate_signals(num_samples).items():
+        for thickness in THICKNESSES:
+            passed &= compare(name, samples, 1.0 / samples_per_pixel, thickness)
+sys.exit(0 if passed else 1)
@@ -0,0 +1,236 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Perfetto flight recorder. Keeps recent trace events in a bounded in-memory
+ * ring and dumps them to a .pftrace file whenever processBlock overruns its
+ * deadline.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "utility/LoadMeter.h"
+#include "utility/Logger.h"
+#include "utility/Settings.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+#if PERFETTO
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Records trace events into a ring and dumps them on overruns.
+ *
+ * @details
+ * While enabled in the settings, the recorder runs its own Perfetto session
+ * with a ring buffer of Settings::Debug::flightRecorderBufferSize kilobytes.
+ * Once the ring is full, the oldest events are overwritten, so it always
+ * holds the most recent events. How many seconds that covers depends on how
+ * many events are emitted.
+ *
+ * The recorder polls the overrun count of a LoadMeter from a background
+ * thread, so the audio thread does no extra work. After an overrun, the
+ * session is stopped, written to a file in the trace directory and started
+ * again. Dumps are at least MIN_DUMP_INTERVAL milliseconds apart and only
+ * the newest MAX_DUMPS files are kept.
+ *
+ * The setting can be toggled at runtime. It is checked on every poll.
+ */
+class FlightRecorder : public juce::Thread
+{
+  using LoadMeter = dmt::utility::LoadMeter;
+  using Logger = dmt::utility::Logger;
+  using BufferConfig = perfetto::TraceConfig::BufferConfig;
+
+  constexpr static int POLL_INTERVAL = 50;
+  constexpr static int MIN_DUMP_INTERVAL = 10000;
+  constexpr static int MAX_DUMPS = 10;
+  constexpr static int THREAD_TIMEOUT = 2000;
+
+  //============================================================================
+  // Settings
+  const bool& enabled = dmt::Settings::Debug::flightRecorder;
+  const int& bufferSize = dmt::Settings::Debug::flightRecorderBufferSize;
+
+public:
+  inline static const juce::File& defaultDirectory =
+    juce::File::getSpecialLocation(
+      juce::File::SpecialLocationType::userApplicationDataDirectory)
+      .getChildFile(ProjectInfo::companyName)
+      .getChildFile(ProjectInfo::projectName)
+      .getChildFile("Traces");
+
+  //============================================================================
+  /**
+   * @brief Constructs the recorder and starts its polling thread.
+   *
+   * @param _loadMeter The load meter to watch for overruns.
+   */
+  inline explicit FlightRecorder(const LoadMeter& _loadMeter) noexcept
+    : juce::Thread("FlightRecorder")
+    , loadMeter(_loadMeter)
+  {
+    startThread(juce::Thread::Priority::background);
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops the polling thread and discards the recorded events.
+   */
+  inline ~FlightRecorder() noexcept override { stopThread(THREAD_TIMEOUT); }
+
+protected:
+  //============================================================================
+  /**
+   * @brief Polls the settings and the load meter until asked to exit.
+   */
+  inline void run() override
+  {
+    while (!threadShouldExit()) {
+      wait(POLL_INTERVAL);
+      poll();
+    }
+    stopSession();
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief Starts or stops the session and dumps it after new overruns.
+   */
+  inline void poll()
+  {
+    const uint64_t numOverruns = loadMeter.getStatistics().numOverruns;
+    const bool hasNewOverruns = numOverruns > lastNumOverruns;
+    lastNumOverruns = numOverruns;
+
+    if (!enabled) {
+      stopSession();
+      return;
+    }
+
+    if (session == nullptr || bufferSize != sessionBufferSize) {
+      stopSession();
+      startSession();
+      return;
+    }
+
+    const auto now = juce::Time::getMillisecondCounter();
+    if (hasNewOverruns && now - lastDumpTime >= MIN_DUMP_INTERVAL) {
+      lastDumpTime = now;
+      dump();
+      startSession();
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Starts a new session that records into a ring buffer.
+   */
+  inline void startSession()
+  {
+    perfetto::TraceConfig config;
+    auto* buffer = config.add_buffers();
+    buffer->set_size_kb(static_cast<uint32_t>(std::max(bufferSize, 1)));
+    buffer->set_fill_policy(BufferConfig::RING_BUFFER);
+    auto* dataSource = config.add_data_sources()->mutable_config();
+    dataSource->set_name("track_event");
+
+    session = perfetto::Tracing::NewTrace();
+    session->Setup(config);
+    session->StartBlocking();
+    sessionBufferSize = bufferSize;
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops the current session without writing it.
+   */
+  inline void stopSession()
+  {
+    if (session == nullptr)
+      return;
+    session->StopBlocking();
+    session.reset();
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops the current session and writes its events to a file.
+   */
+  inline void dump()
+  {
+    session->StopBlocking();
+    const std::vector<char> trace(session->ReadTraceBlocking());
+    session.reset();
+
+    defaultDirectory.createDirectory();
+    const auto file = defaultDirectory.getChildFile(
+      "overrun-" +
+      juce::Time::getCurrentTime().formatted("%Y-%m-%d_%H-%M-%S") +
+      ".pftrace");
+    if (file.replaceWithData(trace.data(), trace.size()))
+      Logger::log("Flight recorder dumped {} bytes", trace.size());
+
+    deleteOldDumps();
+  }
+
+  //============================================================================
+  /**
+   * @brief Deletes all but the newest MAX_DUMPS trace files.
+   */
+  inline void deleteOldDumps()
+  {
+    auto files = defaultDirectory.findChildFiles(
+      juce::File::findFiles, false, "overrun-*.pftrace");
+    if (files.size() <= MAX_DUMPS)
+      return;
+
+    // The timestamps in the file names sort chronologically
+    files.sort();
+    for (int index = 0; index < files.size() - MAX_DUMPS; ++index)
+      files.getReference(index).deleteFile();
+  }
+
+  //============================================================================
+  const LoadMeter& loadMeter;
+  std::unique_ptr<perfetto::TracingSession> session;
+  uint64_t lastNumOverruns = 0;
+  uint32_t lastDumpTime = 0;
+  int sessionBufferSize = 0;
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlightRecorder)
+};
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
+
+#endif
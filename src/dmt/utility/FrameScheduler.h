@@ -0,0 +1,213 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * This file defines the FrameScheduler, which ticks the animated components
+ * of one window from the vertical blank of its display. Components only get
+ * a frame while they have pending work.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "dmt/utility/Settings.h"
+#include <JuceHeader.h>
+#include <algorithm>
+
+//==============================================================================
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Central frame clock for all animated components of one window.
+ *
+ * @details
+ * The scheduler is attached to the vertical blank of the peer its host
+ * component lives on, so every frame is presented right before the display
+ * refreshes instead of drifting against it like a free-running timer. The
+ * vblank rate is throttled down to the configured framerate, and all clients
+ * are ticked in the same vblank.
+ *
+ * Clients are looked up by their components through the parent hierarchy,
+ * so the host component is usually the top-level component of an editor.
+ * Whether a client actually needs the tick is up to the client itself.
+ *
+ * While the host isn't showing, for example because the editor is minimized
+ * or sits on a background tab of the host, no client is ticked at all. The
+ * first vblank after it shows up again resumes all of them.
+ */
+class FrameScheduler
+{
+  //============================================================================
+  // Settings
+  const int& fps = Settings::framerate;
+
+  // A frame is taken if it is due within this many milliseconds
+  constexpr static double VBLANK_TOLERANCE = 2.0;
+
+public:
+  //============================================================================
+  /**
+   * @brief A component that wants to be ticked by a FrameScheduler.
+   *
+   * @details
+   * A client belongs to at most one scheduler at a time and removes itself
+   * from it when destroyed.
+   */
+  class Client
+  {
+  public:
+    inline Client() noexcept = default;
+    inline virtual ~Client() noexcept;
+
+  protected:
+    //==========================================================================
+    /**
+     * @brief Called once per frame while the client is scheduled.
+     */
+    virtual void frameCallback() noexcept = 0;
+
+    //==========================================================================
+    /**
+     * @brief Gets the scheduler this client belongs to.
+     *
+     * @return The scheduler, or nullptr if the client isn't scheduled.
+     */
+    [[nodiscard]] inline FrameScheduler* getFrameScheduler() const noexcept
+    {
+      return scheduler;
+    }
+
+  private:
+    friend class FrameScheduler;
+    FrameScheduler* scheduler = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE(Client)
+  };
+
+  //============================================================================
+  /**
+   * @brief Constructs a scheduler for the given host component.
+   *
+   * @param _host The component whose peer provides the vertical blank.
+   */
+  inline explicit FrameScheduler(juce::Component& _host) noexcept
+    : host(_host)
+    , vBlankAttachment(&_host, [this] { vBlankCallback(); })
+  {
+  }
+
+  //============================================================================
+  /**
+   * @brief Detaches all remaining clients.
+   */
+  inline virtual ~FrameScheduler() noexcept
+  {
+    for (auto* client : clients)
+      client->scheduler = nullptr;
+  }
+
+  //============================================================================
+  /**
+   * @brief Adds a client, moving it away from its previous scheduler.
+   *
+   * @param _client The client to tick on every frame.
+   */
+  inline void addClient(Client& _client) noexcept
+  {
+    if (_client.scheduler == this)
+      return;
+    if (_client.scheduler != nullptr)
+      _client.scheduler->removeClient(_client);
+    clients.add(&_client);
+    _client.scheduler = this;
+  }
+
+  //============================================================================
+  /**
+   * @brief Removes a client. Does nothing if it belongs to another scheduler.
+   *
+   * @param _client The client to remove.
+   */
+  inline void removeClient(Client& _client) noexcept
+  {
+    if (_client.scheduler != this)
+      return;
+    clients.removeFirstMatchingValue(&_client);
+    _client.scheduler = nullptr;
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief Ticks all clients if a frame is due.
+   *
+   * @details
+   * Frames are due on a fixed grid of the frame interval rather than relative
+   * to the last tick, so the average framerate holds even if the vblank rate
+   * isn't a multiple of it. After a stall the grid restarts instead of
+   * catching up with a burst of frames.
+   */
+  inline void vBlankCallback() noexcept
+  {
+    if (!host.isShowing()) [[unlikely]]
+      return;
+
+    const double now = juce::Time::getMillisecondCounterHiRes();
+    if (now + VBLANK_TOLERANCE < nextFrameTime)
+      return;
+
+    const double interval = 1000.0 / static_cast<double>(std::max(fps, 1));
+    nextFrameTime += interval;
+    if (nextFrameTime < now)
+      nextFrameTime = now + interval;
+
+    // Clients may remove themselves while being ticked
+    for (int i = clients.size(); --i >= 0;)
+      if (i < clients.size())
+        clients.getUnchecked(i)->frameCallback();
+  }
+
+  //============================================================================
+  juce::Component& host;
+  juce::Array<Client*> clients;
+  double nextFrameTime = 0.0;
+  juce::VBlankAttachment vBlankAttachment;
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameScheduler)
+};
+
+//==============================================================================
+inline FrameScheduler::Client::~Client() noexcept
+{
+  if (scheduler != nullptr)
+    scheduler->removeClient(*this);
+}
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
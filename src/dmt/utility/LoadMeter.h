@@ -0,0 +1,294 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Measures how much of its deadline every processBlock call uses and keeps a
+ * lock-free histogram of it, so the load of a single plugin instance can be
+ * inspected at runtime.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "utility/Logger.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Lock-free processBlock load meter.
+ *
+ * @details
+ * The load of a block is its execution time divided by its deadline, which
+ * is the duration of the audio it processes. A load above 1 is an overrun,
+ * because the block took longer than the audio it produced.
+ *
+ * Loads are counted in a histogram with NUM_BINS bins covering 0 to MAX_LOAD
+ * times the deadline. Anything above lands in the last bin. Only the audio
+ * thread writes, so every update is a plain atomic store. Any thread can
+ * read the statistics at any time. They are consistent enough for a display,
+ * but not a snapshot of one exact moment.
+ *
+ * Time is measured with juce::Time::getHighResolutionTicks(), which reads a
+ * user-space clock on all supported platforms, so measuring a block costs
+ * two clock reads and no system call.
+ */
+class alignas(64) LoadMeter
+{
+  using Logger = dmt::utility::Logger;
+
+public:
+  constexpr static int NUM_BINS = 100;
+  constexpr static float MAX_LOAD = 2.0f;
+  constexpr static float BINS_PER_LOAD = NUM_BINS / MAX_LOAD;
+
+  //============================================================================
+  /**
+   * @brief The statistics of all blocks measured since the last reset.
+   */
+  struct Statistics
+  {
+    uint64_t numBlocks = 0;
+    uint64_t numOverruns = 0;
+    float lastLoad = 0.0f;
+    float peakLoad = 0.0f;
+    float p99Load = 0.0f;
+  };
+
+  //============================================================================
+  /**
+   * @brief Measures the scope it lives in and records it on destruction.
+   */
+  class ScopedMeasurement
+  {
+  public:
+    ScopedMeasurement(LoadMeter& _meter, const int _numSamples) noexcept
+      : meter(_meter)
+      , numSamples(_numSamples)
+      , start(juce::Time::getHighResolutionTicks())
+    {
+    }
+
+    ~ScopedMeasurement() noexcept
+    {
+      meter.record(juce::Time::getHighResolutionTicks() - start, numSamples);
+    }
+
+  private:
+    LoadMeter& meter;
+    const int numSamples;
+    const juce::int64 start;
+
+    JUCE_DECLARE_NON_COPYABLE(ScopedMeasurement)
+  };
+
+  //============================================================================
+  /**
+   * @brief Prepares the meter for the given sample rate and resets it.
+   *
+   * @param _sampleRate The sample rate.
+   *
+   * @details
+   * Must not be called while the audio thread is recording.
+   */
+  inline void prepare(const double _sampleRate) noexcept
+  {
+    if (_sampleRate > 0.0)
+      ticksPerSample =
+        static_cast<double>(juce::Time::getHighResolutionTicksPerSecond()) /
+        _sampleRate;
+    clearStatistics();
+  }
+
+  //============================================================================
+  /**
+   * @brief Starts measuring a block.
+   *
+   * @param _numSamples The number of samples of the block.
+   * @return A measurement that records the block when it goes out of scope.
+   */
+  [[nodiscard]] forcedinline ScopedMeasurement measure(
+    const int _numSamples) noexcept
+  {
+    return ScopedMeasurement(*this, _numSamples);
+  }
+
+  //============================================================================
+  /**
+   * @brief Records the execution time of a block. Audio thread only.
+   *
+   * @param _ticks The execution time in high resolution ticks.
+   * @param _numSamples The number of samples of the block.
+   */
+  forcedinline void record(const juce::int64 _ticks,
+                           const int _numSamples) noexcept
+  {
+    if (_numSamples <= 0 || ticksPerSample <= 0.0) [[unlikely]]
+      return;
+
+    if (resetRequested.load(std::memory_order_relaxed)) [[unlikely]] {
+      resetRequested.store(false, std::memory_order_relaxed);
+      clearStatistics();
+    }
+
+    const float load = static_cast<float>(
+      static_cast<double>(_ticks) / (ticksPerSample * _numSamples));
+    const int bin = std::min(static_cast<int>(load * BINS_PER_LOAD),
+                             NUM_BINS - 1);
+    increment(histogram[static_cast<size_t>(bin)]);
+    increment(numBlocks);
+    lastLoad.store(load, std::memory_order_relaxed);
+    if (load > peakLoad.load(std::memory_order_relaxed))
+      peakLoad.store(load, std::memory_order_relaxed);
+
+    if (load > 1.0f) [[unlikely]] {
+      increment(numOverruns);
+      Logger::log("processBlock overran its deadline: {} samples at {} load",
+                  _numSamples,
+                  load);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Requests a reset of the statistics. Can be called from any thread.
+   *
+   * @details
+   * The audio thread performs the reset before recording its next block.
+   */
+  inline void reset() noexcept
+  {
+    resetRequested.store(true, std::memory_order_relaxed);
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the statistics. Can be called from any thread.
+   *
+   * @return The statistics since the last reset.
+   */
+  [[nodiscard]] inline Statistics getStatistics() const noexcept
+  {
+    Statistics statistics;
+    statistics.numBlocks = numBlocks.load(std::memory_order_relaxed);
+    statistics.numOverruns = numOverruns.load(std::memory_order_relaxed);
+    statistics.lastLoad = lastLoad.load(std::memory_order_relaxed);
+    statistics.peakLoad = peakLoad.load(std::memory_order_relaxed);
+    statistics.p99Load = getPercentile(0.99);
+    return statistics;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the load that a fraction of all blocks stayed below.
+   *
+   * @param _fraction The fraction of blocks, e.g. 0.99 for the p99 load.
+   * @return The upper edge of the histogram bin the percentile falls into.
+   */
+  [[nodiscard]] inline float getPercentile(
+    const double _fraction) const noexcept
+  {
+    std::array<uint64_t, NUM_BINS> counts;
+    uint64_t total = 0;
+    for (size_t bin = 0; bin < counts.size(); ++bin) {
+      counts[bin] = histogram[bin].load(std::memory_order_relaxed);
+      total += counts[bin];
+    }
+    if (total == 0)
+      return 0.0f;
+
+    // The epsilon keeps fractions like 0.99 from rounding up by one block
+    const double exactThreshold = static_cast<double>(total) * _fraction;
+    const auto threshold =
+      static_cast<uint64_t>(std::ceil(exactThreshold - 1e-6));
+    uint64_t count = 0;
+    for (size_t bin = 0; bin < counts.size(); ++bin) {
+      count += counts[bin];
+      if (count >= threshold)
+        return static_cast<float>(bin + 1) / BINS_PER_LOAD;
+    }
+    return MAX_LOAD;
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets the number of blocks counted in a histogram bin.
+   *
+   * @param _bin The bin index. Bin i counts loads from i to i + 1 divided by
+   * BINS_PER_LOAD.
+   * @return The number of blocks.
+   */
+  [[nodiscard]] inline uint64_t getBinCount(const int _bin) const noexcept
+  {
+    jassert(_bin >= 0 && _bin < NUM_BINS);
+    return histogram[static_cast<size_t>(_bin)].load(std::memory_order_relaxed);
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief Increments a counter that only the audio thread writes.
+   *
+   * @param _counter The counter.
+   */
+  forcedinline static void increment(std::atomic<uint64_t>& _counter) noexcept
+  {
+    _counter.store(_counter.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+  }
+
+  //============================================================================
+  /**
+   * @brief Clears all statistics.
+   */
+  inline void clearStatistics() noexcept
+  {
+    for (auto& bin : histogram)
+      bin.store(0, std::memory_order_relaxed);
+    numBlocks.store(0, std::memory_order_relaxed);
+    numOverruns.store(0, std::memory_order_relaxed);
+    lastLoad.store(0.0f, std::memory_order_relaxed);
+    peakLoad.store(0.0f, std::memory_order_relaxed);
+  }
+
+  //============================================================================
+  double ticksPerSample = 0.0;
+  std::array<std::atomic<uint64_t>, NUM_BINS> histogram{};
+  std::atomic<uint64_t> numBlocks{ 0 };
+  std::atomic<uint64_t> numOverruns{ 0 };
+  std::atomic<float> lastLoad{ 0.0f };
+  std::atomic<float> peakLoad{ 0.0f };
+  std::atomic<bool> resetRequested{ false };
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoadMeter)
+};
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
@@ -0,0 +1,217 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Background thread that drains the Logger into a rotating log file in the
+ * user application data directory.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include "utility/Logger.h"
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Drains the Logger into a rotating log file.
+ *
+ * @details
+ * Wakes up every DRAIN_INTERVAL milliseconds, sorts the pending records of
+ * all channels by time and appends them to the log file. Once the file grows
+ * beyond MAX_FILE_SIZE, it is rotated, keeping at most MAX_FILES files.
+ *
+ * Only one writer should exist per process, so it is meant to be held
+ * through a juce::SharedResourcePointer. While no writer exists, records
+ * pile up in the channels until they are full and newer ones are dropped.
+ */
+class LogWriter : public juce::Thread
+{
+  using Logger = dmt::utility::Logger;
+
+  constexpr static int DRAIN_INTERVAL = 100;
+  constexpr static int THREAD_TIMEOUT = 1000;
+  constexpr static juce::int64 MAX_FILE_SIZE = 1024 * 1024;
+  constexpr static int MAX_FILES = 3;
+
+  //============================================================================
+  struct Entry
+  {
+    int channel;
+    Logger::Record record;
+  };
+
+public:
+  inline static const juce::File& defaultDirectory =
+    juce::File::getSpecialLocation(
+      juce::File::SpecialLocationType::userApplicationDataDirectory)
+      .getChildFile(ProjectInfo::companyName)
+      .getChildFile(ProjectInfo::projectName)
+      .getChildFile("Logs");
+
+  //============================================================================
+  /**
+   * @brief Constructs the writer and starts the drain thread.
+   */
+  inline LogWriter() noexcept
+    : juce::Thread("LogWriter")
+  {
+    entries.reserve(Logger::MAX_CHANNELS * Logger::CHANNEL_CAPACITY);
+    startThread(juce::Thread::Priority::background);
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops the drain thread after writing the remaining records.
+   */
+  inline ~LogWriter() noexcept override { stopThread(THREAD_TIMEOUT); }
+
+protected:
+  //============================================================================
+  /**
+   * @brief Drains the logger until the thread is asked to exit.
+   */
+  inline void run() override
+  {
+    openFile();
+    while (!threadShouldExit()) {
+      wait(DRAIN_INTERVAL);
+      drain();
+    }
+    drain();
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief Writes all pending records to the log file.
+   */
+  inline void drain()
+  {
+    entries.clear();
+    const uint64_t numDropped = Logger::drain(
+      [this](const int _channel, const Logger::Record& _record) {
+        entries.push_back({ _channel, _record });
+      });
+
+    // Records of different channels are only ordered within their channel
+    std::stable_sort(
+      entries.begin(), entries.end(), [](const Entry& _a, const Entry& _b) {
+        return _a.record.ticks < _b.record.ticks;
+      });
+
+    for (const auto& entry : entries) {
+      const double seconds =
+        juce::Time::highResolutionTicksToSeconds(entry.record.ticks);
+      writeLine("[" + juce::String(seconds, 6) + "] [" +
+                juce::String(entry.channel) + "] " +
+                Logger::format(entry.record));
+    }
+    if (numDropped > 0)
+      writeLine("Dropped " + juce::String(numDropped) + " log records");
+
+    if (stream != nullptr)
+      stream->flush();
+  }
+
+  //============================================================================
+  /**
+   * @brief Appends a line to the log file and rotates it if it got too big.
+   *
+   * @param _line The line without a line break.
+   */
+  inline void writeLine(const juce::String& _line)
+  {
+    if (stream == nullptr)
+      return;
+
+    *stream << _line << juce::newLine;
+    if (stream->getPosition() > MAX_FILE_SIZE) [[unlikely]] {
+      rotateFiles();
+      openFile();
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Opens the current log file for appending.
+   */
+  inline void openFile()
+  {
+    defaultDirectory.createDirectory();
+    stream = std::make_unique<juce::FileOutputStream>(getFile(0));
+    if (stream->failedToOpen()) {
+      stream.reset();
+      return;
+    }
+    *stream << "Log opened at " << juce::Time::getCurrentTime().toISO8601(true)
+            << " (high resolution time "
+            << juce::String(juce::Time::getMillisecondCounterHiRes() / 1000.0,
+                            6)
+            << ")" << juce::newLine;
+  }
+
+  //============================================================================
+  /**
+   * @brief Closes the current log file and shifts all files by one.
+   */
+  inline void rotateFiles()
+  {
+    stream.reset();
+    getFile(MAX_FILES - 1).deleteFile();
+    for (int index = MAX_FILES - 1; index > 0; --index)
+      getFile(index - 1).moveFileTo(getFile(index));
+  }
+
+  //============================================================================
+  /**
+   * @brief Gets a log file.
+   *
+   * @param _index The age of the file, where 0 is the current one.
+   * @return The file.
+   */
+  [[nodiscard]] inline static juce::File getFile(const int _index)
+  {
+    const juce::String suffix =
+      _index == 0 ? juce::String() : "." + juce::String(_index);
+    const juce::String name = ProjectInfo::projectName;
+    return defaultDirectory.getChildFile(name + suffix + ".log");
+  }
+
+  //============================================================================
+  std::unique_ptr<juce::FileOutputStream> stream;
+  std::vector<Entry> entries;
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LogWriter)
+};
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
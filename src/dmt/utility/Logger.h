@@ -0,0 +1,363 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * A wait-free logger that can be used from the audio thread. Every thread
+ * records fixed-size records into its own ring buffer, which a LogWriter
+ * drains to a file in the background.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include <JuceHeader.h>
+
+//==============================================================================
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Wait-free logger for real-time threads.
+ *
+ * @details
+ * A record consists of a timestamp, a format string and up to MAX_ARGUMENTS
+ * numeric arguments. Records are never formatted by the thread that logs
+ * them. The format string must be a string literal, and its address serves
+ * as the ID of the message, so only a pointer is stored. Arguments replace
+ * the "{}" placeholders of the format string in order once a LogWriter
+ * drains the record.
+ *
+ * Each thread owns one channel, a single-producer single-consumer ring of
+ * records. Logging takes a bounded number of steps and makes no system
+ * calls, so it is safe to call from processBlock. If a channel is full, the
+ * record is dropped and counted, and the writer reports the number of
+ * dropped records.
+ *
+ * A thread claims a free channel on its first record. The thread only keeps
+ * a trivially destructible thread-local pointer to it, so the first record
+ * of a thread doesn't register a thread exit handler or allocate either.
+ * Channels are never released by their threads. Instead the writer reclaims
+ * a channel once it went RECLAIM_DRAINS drains without a new record, and a
+ * thread that lost its channel claims a new one with its next record. While
+ * all channels are taken, records of further threads are not logged.
+ *
+ * @note All state is static, so every plugin instance in a process shares
+ * the same channels.
+ */
+class Logger
+{
+public:
+  constexpr static int MAX_ARGUMENTS = 4;
+  constexpr static int MAX_CHANNELS = 16;
+  constexpr static int CHANNEL_CAPACITY = 1024;
+  constexpr static int RECLAIM_DRAINS = 50;
+
+  //============================================================================
+  /**
+   * @brief A format string that is guaranteed to be a string literal.
+   */
+  struct Format
+  {
+    template<size_t Size>
+    consteval Format(const char (&_text)[Size]) noexcept
+      : text(_text)
+    {
+    }
+
+    const char* text;
+  };
+
+  //============================================================================
+  /**
+   * @brief One logged message with its arguments, not yet formatted.
+   */
+  struct alignas(64) Record
+  {
+    union Argument
+    {
+      int64_t integer;
+      double real;
+    };
+
+    int64_t ticks;
+    const char* format;
+    std::array<Argument, MAX_ARGUMENTS> arguments;
+    std::array<bool, MAX_ARGUMENTS> isReal;
+    uint8_t numArguments;
+  };
+  static_assert(sizeof(Record) == 64, "A record must fit one cache line");
+
+  //============================================================================
+  /**
+   * @brief Records a message.
+   *
+   * @tparam Arguments The argument types. Must be integers or floating point
+   * numbers.
+   * @param _format The format string literal with one "{}" per argument.
+   * @param _arguments The arguments.
+   *
+   * @details
+   * Wait-free. Does nothing if the channel of this thread is full or no
+   * channel is left for it. The channel is marked busy while the record is
+   * written, so the writer can't reclaim it meanwhile.
+   */
+  template<typename... Arguments>
+  forcedinline static void log(const Format _format,
+                               const Arguments... _arguments) noexcept
+  {
+    static_assert(sizeof...(Arguments) <= MAX_ARGUMENTS,
+                  "Too many log arguments");
+    static_assert((std::is_arithmetic_v<Arguments> && ...),
+                  "Log arguments must be numbers");
+
+    Channel* channel = acquireChannel();
+    if (channel == nullptr) [[unlikely]]
+      return;
+
+    const uint64_t writeIndex =
+      channel->writeIndex.load(std::memory_order_relaxed);
+    const uint64_t readIndex =
+      channel->readIndex.load(std::memory_order_acquire);
+    if (writeIndex - readIndex >= CHANNEL_CAPACITY) [[unlikely]] {
+      channel->numDropped.fetch_add(1, std::memory_order_relaxed);
+      releaseChannel(*channel);
+      return;
+    }
+
+    Record& record = channel->records[writeIndex & CHANNEL_MASK];
+    record.ticks = juce::Time::getHighResolutionTicks();
+    record.format = _format.text;
+    record.numArguments = static_cast<uint8_t>(sizeof...(Arguments));
+    size_t index = 0;
+    (setArgument(record, index++, _arguments), ...);
+
+    channel->writeIndex.store(writeIndex + 1, std::memory_order_release);
+    releaseChannel(*channel);
+  }
+
+  //============================================================================
+  /**
+   * @brief Hands all pending records to a callback. Only called by the
+   * LogWriter.
+   *
+   * @param _callback Called with the channel index and each record, in the
+   * order they were logged per channel.
+   * @return The number of records dropped since the last call.
+   *
+   * @details
+   * Also reclaims the channels that went RECLAIM_DRAINS calls without a new
+   * record, since their threads may have exited.
+   */
+  template<typename Callback>
+  static uint64_t drain(Callback&& _callback) noexcept
+  {
+    uint64_t numDropped = 0;
+    for (int index = 0; index < MAX_CHANNELS; ++index) {
+      Channel& channel = channels[static_cast<size_t>(index)];
+      const uint64_t writeIndex =
+        channel.writeIndex.load(std::memory_order_acquire);
+      uint64_t readIndex = channel.readIndex.load(std::memory_order_relaxed);
+      const bool isIdle = readIndex == writeIndex;
+      for (; readIndex != writeIndex; ++readIndex)
+        _callback(index, channel.records[readIndex & CHANNEL_MASK]);
+      channel.readIndex.store(readIndex, std::memory_order_release);
+      numDropped += channel.numDropped.exchange(0, std::memory_order_relaxed);
+      reclaimChannel(channel, isIdle);
+    }
+    return numDropped;
+  }
+
+  //============================================================================
+  /**
+   * @brief Formats a record by replacing the placeholders with its arguments.
+   *
+   * @param _record The record to format.
+   * @return The formatted message.
+   */
+  [[nodiscard]] static juce::String format(const Record& _record)
+  {
+    juce::String message;
+    int argumentIndex = 0;
+    for (const char* character = _record.format; *character != '\0';
+         ++character) {
+      const bool isPlaceholder = character[0] == '{' && character[1] == '}';
+      if (!isPlaceholder || argumentIndex >= _record.numArguments) {
+        message << juce::String::charToString(*character);
+        continue;
+      }
+      const auto index = static_cast<size_t>(argumentIndex++);
+      if (_record.isReal[index])
+        message << juce::String(_record.arguments[index].real);
+      else
+        message << juce::String(_record.arguments[index].integer);
+      ++character;
+    }
+    return message;
+  }
+
+private:
+  constexpr static uint64_t CHANNEL_MASK = CHANNEL_CAPACITY - 1;
+  constexpr static uint64_t BUSY_FLAG = uint64_t(1) << 63;
+  static_assert((CHANNEL_CAPACITY & CHANNEL_MASK) == 0,
+                "Channel capacity must be a power of two");
+
+  //============================================================================
+  /**
+   * @brief The ring of records of one thread.
+   *
+   * @details
+   * The atomics are value-initialized to zero, so the static channels are
+   * constant-initialized and need no guard on first use. The owner is zero
+   * while the channel is free, and otherwise holds the token of the thread
+   * that claimed it, flagged with BUSY_FLAG while a record is written.
+   */
+  struct alignas(64) Channel
+  {
+    std::array<Record, CHANNEL_CAPACITY> records;
+    alignas(64) std::atomic<uint64_t> writeIndex;
+    std::atomic<uint64_t> numDropped;
+    alignas(64) std::atomic<uint64_t> readIndex;
+    int numIdleDrains;
+    alignas(64) std::atomic<uint64_t> owner;
+  };
+
+  //============================================================================
+  /**
+   * @brief The logging state of a thread.
+   *
+   * @details
+   * Trivially destructible, so the thread-local needs no exit handler.
+   */
+  struct ThreadState
+  {
+    Channel* channel;
+    uint64_t token;
+  };
+  static_assert(std::is_trivially_destructible_v<ThreadState>,
+                "The thread state must not need a thread exit handler");
+
+  //============================================================================
+  /**
+   * @brief Marks the channel of the calling thread busy, claiming a free one
+   * if the thread has none or the writer reclaimed it.
+   *
+   * @return The channel, or nullptr if all channels are taken.
+   */
+  [[nodiscard]] forcedinline static Channel* acquireChannel() noexcept
+  {
+    ThreadState& state = threadState;
+    if (state.token == 0) [[unlikely]]
+      state.token = nextToken.fetch_add(1, std::memory_order_relaxed);
+
+    if (state.channel != nullptr) [[likely]] {
+      uint64_t expected = state.token;
+      if (state.channel->owner.compare_exchange_strong(
+            expected, state.token | BUSY_FLAG, std::memory_order_acquire))
+        return state.channel;
+      state.channel = nullptr;
+    }
+
+    for (auto& candidate : channels) {
+      uint64_t expected = 0;
+      if (candidate.owner.compare_exchange_strong(
+            expected, state.token | BUSY_FLAG, std::memory_order_acquire)) {
+        state.channel = &candidate;
+        return state.channel;
+      }
+    }
+    return nullptr;
+  }
+
+  //============================================================================
+  /**
+   * @brief Clears the busy flag of the channel of the calling thread.
+   *
+   * @param _channel The channel returned by acquireChannel().
+   */
+  forcedinline static void releaseChannel(Channel& _channel) noexcept
+  {
+    _channel.owner.store(threadState.token, std::memory_order_release);
+  }
+
+  //============================================================================
+  /**
+   * @brief Frees a channel that has been idle for too long. Only called by
+   * the writer.
+   *
+   * @param _channel The channel.
+   * @param _isIdle True if the channel had no new records since the last
+   * drain.
+   *
+   * @details
+   * Fails if the owner is writing a record right now, in which case the
+   * channel is retried with the next drain.
+   */
+  static void reclaimChannel(Channel& _channel, const bool _isIdle) noexcept
+  {
+    uint64_t owner = _channel.owner.load(std::memory_order_relaxed);
+    if (!_isIdle || owner == 0) {
+      _channel.numIdleDrains = 0;
+      return;
+    }
+    if (++_channel.numIdleDrains < RECLAIM_DRAINS || (owner & BUSY_FLAG))
+      return;
+
+    if (_channel.owner.compare_exchange_strong(
+          owner, 0, std::memory_order_acq_rel))
+      _channel.numIdleDrains = 0;
+  }
+
+  //============================================================================
+  /**
+   * @brief Stores one argument of a record.
+   *
+   * @param _record The record.
+   * @param _index The index of the argument.
+   * @param _argument The argument.
+   */
+  template<typename Argument>
+  forcedinline static void setArgument(Record& _record,
+                                       const size_t _index,
+                                       const Argument _argument) noexcept
+  {
+    if constexpr (std::is_floating_point_v<Argument>) {
+      _record.arguments[_index].real = static_cast<double>(_argument);
+      _record.isReal[_index] = true;
+    } else {
+      _record.arguments[_index].integer = static_cast<int64_t>(_argument);
+      _record.isReal[_index] = false;
+    }
+  }
+
+  //============================================================================
+  inline static std::array<Channel, MAX_CHANNELS> channels;
+  inline static std::atomic<uint64_t> nextToken{ 1 };
+  inline static thread_local constinit ThreadState threadState{};
+};
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <bit>
 
 //==============================================================================
 
@@ -321,6 +322,77 @@ linearToExponent(float value) noexcept
   return (value >= 0.0f) ? (value + 1.0f) : (1.0f / -(value + 1.0f));
 }
 
+/**
+ * Approximates the base 2 logarithm of a positive value.
+ *
+ * The exponent is taken from the float representation and the logarithm of
+ * the mantissa is approximated with a polynomial. The absolute error is below
+ * 3e-6 for all positive normal inputs.
+ *
+ * @param value The value, which must be greater than zero.
+ * @return The approximated base 2 logarithm.
+ */
+static inline float
+fastLog2(float value) noexcept
+{
+  const auto bits = std::bit_cast<int32_t>(value);
+  const auto exponent = static_cast<float>(((bits >> 23) & 0xFF) - 127);
+  const float m =
+    std::bit_cast<float>((bits & 0x007FFFFF) | 0x3F800000) - 1.0f;
+  const float mantissa =
+    2.123736895e-06f +
+    m * (1.442475315e+00f +
+         m * (-7.175578741e-01f +
+              m * (4.555270936e-01f +
+                   m * (-2.746232662e-01f +
+                        m * (1.192982439e-01f + m * -2.512320500e-02f)))));
+  return exponent + mantissa;
+}
+
+/**
+ * Approximates 2 raised to the power of a value.
+ *
+ * The integer part is written into the exponent of the result and the
+ * fractional part is approximated with a polynomial. The relative error is
+ * below 2e-7. Inputs are clamped to the range of normal floats.
+ *
+ * @param value The exponent.
+ * @return The approximated power of two.
+ */
+static inline float
+fastExp2(float value) noexcept
+{
+  const float clamped = std::clamp(value, -126.0f, 127.0f);
+  const float whole = std::floor(clamped);
+  const float f = clamped - whole;
+  const float fraction =
+    9.999998958e-01f +
+    f * (6.931546198e-01f +
+         f * (2.401407714e-01f +
+              f * (5.586327910e-02f +
+                   f * (8.946218644e-03f + f * 1.895105728e-03f))));
+  const auto exponent = (static_cast<int32_t>(whole) + 127) << 23;
+  return fraction * std::bit_cast<float>(exponent);
+}
+
+/**
+ * Approximates a non-negative base raised to a power.
+ *
+ * Combines fastLog2() and fastExp2(), so the relative error grows with the
+ * exponent and is about 2e-6 times the exponent.
+ *
+ * @param base The base. Zero and negative bases return zero.
+ * @param exponent The exponent.
+ * @return The approximated power.
+ */
+static inline float
+fastPow(float base, float exponent) noexcept
+{
+  if (base <= 0.0f)
+    return 0.0f;
+  return fastExp2(exponent * fastLog2(base));
+}
+
 /**
  * Calculates the coordinates of a point on a circle given a radius and angle.
  *
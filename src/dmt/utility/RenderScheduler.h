@@ -0,0 +1,298 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * This file defines the RenderScheduler, a process-wide pool of worker
+ * threads that renders frames for GUI components in the background. Jobs
+ * that are still pending are not queued a second time, and workers without
+ * jobs shut down until they are needed again.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+
+namespace dmt {
+namespace utility {
+
+//==============================================================================
+/**
+ * @brief Process-wide pool of render worker threads.
+ *
+ * @details
+ * Components own a Job and submit it whenever a new frame should be
+ * rendered. A job that is still queued or running is not queued again, so
+ * the submission is dropped and the running frame picks up the newest data
+ * anyway. This keeps the queue as short as the number of components with
+ * pending work, and no component can fall behind by more than one frame.
+ *
+ * The number of workers is derived from the physical CPU count and limited
+ * to MAX_WORKERS, no matter how many plugin instances are open. Workers are
+ * only started by the first submission, and a worker that found nothing to
+ * do for IDLE_TIMEOUT milliseconds exits again. An idle GUI therefore keeps
+ * no render threads alive at all, and the next submission restarts them.
+ *
+ * Only one scheduler should exist per process, so it is meant to be held
+ * through a juce::SharedResourcePointer.
+ */
+class RenderScheduler
+{
+  constexpr static int MAX_WORKERS = 4;
+  constexpr static int THREAD_TIMEOUT = 1000;
+  constexpr static int IDLE_TIMEOUT = 2000;
+
+public:
+  //============================================================================
+  /**
+   * @brief A unit of work that renders one frame of a component.
+   *
+   * @details
+   * The function runs on one of the workers. A job is never run by two
+   * workers at the same time. It must be cancelled before anything the
+   * function uses is destroyed.
+   */
+  class Job
+  {
+  public:
+    using Function = std::function<void()>;
+
+    /**
+     * @brief Constructs a job.
+     *
+     * @param _function The function that renders a frame.
+     */
+    explicit Job(Function _function) noexcept
+      : function(std::move(_function))
+    {
+    }
+
+    /**
+     * @brief Checks whether the job is queued or running.
+     *
+     * @return True until the function of the last submission has returned.
+     *
+     * @details
+     * Once this returned false, everything the function did is visible to
+     * the caller, so the data it reads can be changed until the next submit.
+     */
+    [[nodiscard]] bool isPending() const noexcept
+    {
+      return pending.load(std::memory_order_acquire);
+    }
+
+  private:
+    friend class RenderScheduler;
+    Function function;
+    std::atomic<bool> pending = false;
+
+    JUCE_DECLARE_NON_COPYABLE(Job)
+  };
+
+  //============================================================================
+  /**
+   * @brief Constructs the scheduler. The workers start with the first job.
+   */
+  inline RenderScheduler()
+  {
+    const int numWorkers =
+      juce::jlimit(1, MAX_WORKERS, juce::SystemStats::getNumPhysicalCpus() / 2);
+    for (int i = 0; i < numWorkers; ++i)
+      workers.push_back(std::make_unique<Worker>(*this, i));
+  }
+
+  //============================================================================
+  /**
+   * @brief Stops all workers. Pending jobs are not run anymore.
+   */
+  inline ~RenderScheduler() noexcept
+  {
+    for (auto& worker : workers)
+      worker->signalThreadShouldExit();
+    for (auto& worker : workers)
+      worker->stopThread(THREAD_TIMEOUT);
+  }
+
+  //============================================================================
+  /**
+   * @brief Queues a job, unless it is still queued or running.
+   *
+   * @param _job The job to run.
+   *
+   * @details
+   * Restarts all workers that retired while the queue was empty.
+   */
+  inline void submit(Job& _job)
+  {
+    if (_job.pending.exchange(true, std::memory_order_acq_rel))
+      return;
+
+    std::array<Worker*, MAX_WORKERS> retiredWorkers{};
+    {
+      const juce::ScopedLock lock(queueLock);
+      queue.push_back(&_job);
+      for (size_t i = 0; i < workers.size(); ++i) {
+        if (workers[i]->retired) {
+          workers[i]->retired = false;
+          retiredWorkers[i] = workers[i].get();
+        }
+      }
+    }
+
+    for (size_t i = 0; i < workers.size(); ++i) {
+      if (auto* worker = retiredWorkers[i]) {
+        // A retired worker returns from run() right away
+        worker->waitForThreadToExit(THREAD_TIMEOUT);
+        worker->startThread();
+      } else {
+        workers[i]->notify();
+      }
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Removes a job from the queue and waits until it isn't running.
+   *
+   * @param _job The job to cancel.
+   *
+   * @details
+   * After this returns, the job is neither queued nor running, until it is
+   * submitted again.
+   */
+  inline void cancel(Job& _job)
+  {
+    {
+      const juce::ScopedLock lock(queueLock);
+      queue.erase(std::remove(queue.begin(), queue.end(), &_job), queue.end());
+    }
+    for (auto& worker : workers)
+      while (worker->currentJob.load(std::memory_order_acquire) == &_job)
+        juce::Thread::yield();
+    _job.pending.store(false, std::memory_order_release);
+  }
+
+private:
+  //============================================================================
+  /**
+   * @brief A single worker thread.
+   */
+  class Worker : public juce::Thread
+  {
+  public:
+    inline Worker(RenderScheduler& _scheduler, const int _index)
+      : juce::Thread("RenderWorker" + juce::String(_index))
+      , scheduler(_scheduler)
+    {
+    }
+
+    inline void run() override
+    {
+      while (!threadShouldExit()) {
+        Job* job = scheduler.pop(*this);
+        if (job == nullptr) {
+          if (!wait(IDLE_TIMEOUT) && scheduler.retire(*this))
+            return;
+          continue;
+        }
+        job->function();
+        job->pending.store(false, std::memory_order_release);
+        currentJob.store(nullptr, std::memory_order_release);
+      }
+    }
+
+    std::atomic<Job*> currentJob = nullptr;
+
+    // Guarded by the queue lock, true while the thread is stopped
+    bool retired = true;
+
+  private:
+    RenderScheduler& scheduler;
+  };
+
+  //============================================================================
+  /**
+   * @brief Takes the oldest job from the queue and assigns it to a worker.
+   *
+   * @param _worker The worker that runs the job.
+   *
+   * @return The job, or nullptr if the queue is empty.
+   *
+   * @details
+   * The job is assigned while the queue is locked, so cancel() either finds
+   * it in the queue or as the current job of a worker.
+   */
+  inline Job* pop(Worker& _worker)
+  {
+    const juce::ScopedLock lock(queueLock);
+    if (queue.empty())
+      return nullptr;
+    Job* job = queue.front();
+    queue.pop_front();
+    _worker.currentJob.store(job, std::memory_order_release);
+    return job;
+  }
+
+  //============================================================================
+  /**
+   * @brief Lets an idle worker exit, unless a job arrived meanwhile.
+   *
+   * @param _worker The worker that timed out waiting for a job.
+   *
+   * @return True if the worker has to return from run().
+   *
+   * @details
+   * Decided while the queue is locked, so a job submitted at the same time
+   * either is seen here or finds the worker retired and restarts it.
+   */
+  inline bool retire(Worker& _worker)
+  {
+    const juce::ScopedLock lock(queueLock);
+    if (!queue.empty())
+      return false;
+    _worker.retired = true;
+    return true;
+  }
+
+  //============================================================================
+  juce::CriticalSection queueLock;
+  std::deque<Job*> queue;
+  std::vector<std::unique_ptr<Worker>> workers;
+
+  //============================================================================
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderScheduler)
+};
+
+//==============================================================================
+} // namespace utility
+} // namespace dmt
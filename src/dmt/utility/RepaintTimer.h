@@ -19,8 +19,8 @@
  *
  * Description:
  * Provides a base class for components that require periodic repainting at a
- * configurable frame rate. Designed for real-time GUI responsiveness and
- * dynamic framerate adaptation, using JUCE's Timer system.
+ * configurable frame rate. Components inside a FrameScheduler host are ticked
+ * in sync with the display, all others fall back to JUCE's Timer system.
  *
  * Authors:
  * Lunix-420 (Primary Author)
@@ -31,6 +31,7 @@
 
 //==============================================================================
 
+#include "dmt/utility/FrameScheduler.h"
 #include "dmt/utility/Settings.h"
 #include <JuceHeader.h>
 
@@ -44,22 +45,28 @@ namespace utility {
  * @brief Base class for repaint-timed components with dynamic framerate.
  *
  * @details
- * This class provides a robust, type-safe mechanism for triggering periodic
- * repaints in JUCE-based components. It automatically adapts to changes in
- * the global framerate setting, ensuring smooth GUI updates without manual
- * polling. Intended for real-time applications where repaint frequency may
- * change at runtime.
+ * While running, the timer registers its component with the closest
+ * FrameScheduler in the parent hierarchy and follows it whenever the
+ * component is moved to another parent. Components without a scheduler above
+ * them, for example before they are added to the window, are driven by a
+ * plain juce::Timer at the global framerate instead.
+ *
+ * Either way, a tick is only delivered while the component is showing and
+ * hasPendingFrame() returns true, so idle components cost nothing per frame.
  *
  * @note
- * Subclasses must implement repaintTimerCallback(), which is called at the
- * configured framerate. The timer will automatically restart if the framerate
- * changes.
+ * Subclasses must implement repaintTimerCallback() and should override
+ * hasPendingFrame() if they are not animated all the time.
  *
  * @warning
- * This class is non-copyable and non-movable. Use only as a base class.
+ * This class is non-copyable and non-movable. Use only as a base class, and
+ * list it after the component base so the component outlives it.
  */
 //==============================================================================
-class RepaintTimer : private juce::Timer
+class RepaintTimer
+  : public FrameScheduler::Client
+  , private juce::Timer
+  , private juce::ComponentListener
 {
   //============================================================================
   // Settings
@@ -70,22 +77,25 @@ protected:
   /**
    * @brief Constructs a RepaintTimer.
    *
+   * @param _component The component that is repainted.
+   *
    * @details
-   * The constructor is constexpr for maximum compile-time optimization and
-   * compatibility with modern C++ standards. The timer is not started
-   * automatically; call startRepaintTimer() to begin.
+   * The timer is not started automatically; call startRepaintTimer() to
+   * begin.
    */
-  inline RepaintTimer() noexcept = default;
+  inline explicit RepaintTimer(juce::Component& _component) noexcept
+    : component(_component)
+  {
+  }
 
   //============================================================================
   /**
    * @brief Destructor.
    *
    * @details
-   * Ensures that the timer is stopped and resources are released. No
-   * side-effects beyond JUCE Timer cleanup.
+   * Stops the timer and leaves the frame scheduler.
    */
-  inline ~RepaintTimer() noexcept override = default;
+  inline ~RepaintTimer() noexcept override { stopRepaintTimer(); }
 
   //============================================================================
   /**
@@ -93,19 +103,20 @@ protected:
    *
    * @details
    * If the timer is already running, this function is a no-op. Otherwise,
-   * it initializes the timer with the current framerate from Settings.
-   * The timer will automatically adapt if the framerate changes.
+   * the component is handed to the closest frame scheduler, or a fallback
+   * timer is started if there is none.
    *
    * @note
    * This method is noexcept and safe to call repeatedly.
    */
   inline void startRepaintTimer() noexcept
   {
-    if (this->isTimerRunning())
+    if (running)
       return;
 
-    this->currentFps = fps;
-    startTimerHz(fps);
+    running = true;
+    component.addComponentListener(this);
+    attachToFrameScheduler();
   }
 
   //============================================================================
@@ -116,7 +127,17 @@ protected:
    * Halts all periodic repaint callbacks. Safe to call even if the timer
    * is not running.
    */
-  inline void stopRepaintTimer() noexcept { stopTimer(); }
+  inline void stopRepaintTimer() noexcept
+  {
+    if (!running)
+      return;
+
+    running = false;
+    component.removeComponentListener(this);
+    if (auto* scheduler = getFrameScheduler())
+      scheduler->removeClient(*this);
+    stopTimer();
+  }
 
   //============================================================================
   /**
@@ -124,35 +145,91 @@ protected:
    *
    * @details
    * Subclasses must implement this pure virtual function to perform
-   * repaint logic. This is called from the timer thread and should be
-   * real-time safe.
+   * repaint logic. This is called on the message thread, but only while
+   * hasPendingFrame() returns true.
    */
   virtual void repaintTimerCallback() noexcept = 0;
 
+  //============================================================================
+  /**
+   * @brief Checks whether the next frame has anything to show.
+   *
+   * @return True if repaintTimerCallback() should be called this frame.
+   *
+   * @details
+   * Called once per frame right before the callback. The default keeps the
+   * component animated all the time.
+   */
+  [[nodiscard]] virtual bool hasPendingFrame() const noexcept { return true; }
+
 private:
   //============================================================================
   /**
-   * @brief Internal JUCE timer callback.
+   * @brief Hands the component to the closest frame scheduler.
+   *
+   * @details
+   * Falls back to the timer if there is no scheduler in the parent
+   * hierarchy.
+   */
+  inline void attachToFrameScheduler() noexcept
+  {
+    auto* scheduler = component.findParentComponentOfClass<FrameScheduler>();
+    if (scheduler != nullptr) {
+      stopTimer();
+      scheduler->addClient(*this);
+      return;
+    }
+
+    if (auto* previousScheduler = getFrameScheduler())
+      previousScheduler->removeClient(*this);
+    if (!isTimerRunning()) {
+      currentFps = fps;
+      startTimerHz(fps);
+    }
+  }
+
+  //============================================================================
+  /**
+   * @brief Ticks the component if it has anything to show.
+   */
+  inline void frameCallback() noexcept override
+  {
+    if (component.isShowing() && hasPendingFrame())
+      repaintTimerCallback();
+  }
+
+  //============================================================================
+  /**
+   * @brief Fallback timer callback.
    *
    * @details
-   * Invokes repaintTimerCallback() and checks for framerate changes.
-   * If the global framerate has changed, the timer is restarted to
-   * match the new rate. This ensures seamless adaptation to runtime
-   * framerate adjustments.
+   * Ticks the component and restarts the timer if the global framerate has
+   * changed.
    */
   inline void timerCallback() override
   {
-    repaintTimerCallback();
+    frameCallback();
     if (fps != currentFps) {
       currentFps = fps;
-      stopRepaintTimer();
-      startRepaintTimer();
+      stopTimer();
+      startTimerHz(fps);
     }
   }
 
+  //============================================================================
+  /**
+   * @brief Follows the component to the scheduler of its new parent.
+   */
+  inline void componentParentHierarchyChanged(juce::Component&) override
+  {
+    attachToFrameScheduler();
+  }
+
   //============================================================================
   // Other members
+  juce::Component& component;
   int currentFps{};
+  bool running = false;
 
   //============================================================================
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RepaintTimer)
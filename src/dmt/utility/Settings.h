@@ -735,6 +735,28 @@ public:
       container.add<float>("Oscilloscope.DefaultGain", 0.0f);
     static inline auto& defaultThickness =
       container.add<float>("Oscilloscope.DefaultThickness", 3.0f);
+
+    // Rendering
+    static inline auto& pixelBudget =
+      container.add<int>("Oscilloscope.PixelBudget", 2000000);
+  };
+
+  //==============================================================================
+  /**
+   * @brief Debugging settings.
+   *
+   * @details
+   * Controls the Perfetto flight recorder. Only has an effect in builds with
+   * PERFETTO enabled.
+   */
+  struct Debug
+  {
+    //==============================================================================
+    // Flight recorder
+    static inline auto& flightRecorder =
+      container.add<bool>("Debug.FlightRecorder", false);
+    static inline auto& flightRecorderBufferSize =
+      container.add<int>("Debug.FlightRecorderBufferSize", 16384);
   };
 
   //==============================================================================
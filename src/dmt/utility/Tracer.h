@@ -0,0 +1,105 @@
+//==============================================================================
+/* ██████╗ ██╗███╗   ███╗███████╗████████╗██╗  ██╗ ██████╗ ██╗  ██╗██╗   ██╗
+ * ██╔══██╗██║████╗ ████║██╔════╝╚══██╔══╝██║  ██║██╔═══██╗╚██╗██╔╝╚██╗ ██╔╝
+ * ██║  ██║██║██╔████╔██║█████╗     ██║   ███████║██║   ██║ ╚███╔╝  ╚████╔╝
+ * ██║  ██║██║██║╚██╔╝██║██╔══╝     ██║   ██╔══██║██║   ██║ ██╔██╗   ╚██╔╝
+ * ██████╔╝██║██║ ╚═╝ ██║███████╗   ██║   ██║  ██║╚██████╔╝██╔╝ ██╗   ██║
+ * ╚═════╝ ╚═╝╚═╝     ╚═╝╚══════╝   ╚═╝   ╚═╝  ╚═╝ ╚═════╝ ╚═╝  ╚═╝   ╚═╝
+ * Copyright (C) 2024 Dimethoxy Audio (https://dimethoxy.com)
+ *
+ * Part of the Dimethoxy Library, primarily intended for Dimethoxy plugins.
+ * External use is permitted but not recommended.
+ * No support or compatibility guarantees are provided.
+ *
+ * License:
+ * This code is licensed under the GPLv3 license. You are permitted to use and
+ * modify this code under the terms of this license.
+ * You must adhere GPLv3 license for any project using this code or parts of it.
+ * Your are not allowed to use this code in any closed-source project.
+ *
+ * Description:
+ * Compile-time granularity levels for TRACER. DSP and GUI code have separate
+ * levels, so one side can be profiled without distorting the other.
+ *
+ * Authors:
+ * Lunix-420 (Primary Author)
+ */
+//==============================================================================
+
+#pragma once
+
+//==============================================================================
+
+#include <JuceHeader.h>
+
+//==============================================================================
+// Trace levels. Each level includes all coarser ones.
+//
+// BLOCK:     Once per audio block or GUI frame.
+// COMPONENT: Once per component, voice or parameter update.
+// SAMPLE:    Per sample or inside inner loops.
+//
+// The levels are set with the DMT_DSP_TRACE_LEVEL and DMT_GUI_TRACE_LEVEL
+// CMake cache variables. Trace points above the configured level compile to
+// nothing, so they cost nothing even when tracing is enabled.
+
+#define DMT_TRACE_LEVEL_NONE 0
+#define DMT_TRACE_LEVEL_BLOCK 1
+#define DMT_TRACE_LEVEL_COMPONENT 2
+#define DMT_TRACE_LEVEL_SAMPLE 3
+
+#if defined(CMAKE_DMT_DSP_TRACE_LEVEL)
+#define DMT_DSP_TRACE_LEVEL CMAKE_DMT_DSP_TRACE_LEVEL
+#else
+#define DMT_DSP_TRACE_LEVEL DMT_TRACE_LEVEL_BLOCK
+#endif
+
+#if defined(CMAKE_DMT_GUI_TRACE_LEVEL)
+#define DMT_GUI_TRACE_LEVEL CMAKE_DMT_GUI_TRACE_LEVEL
+#else
+#define DMT_GUI_TRACE_LEVEL DMT_TRACE_LEVEL_COMPONENT
+#endif
+
+//==============================================================================
+// DSP trace points
+
+#if DMT_DSP_TRACE_LEVEL >= DMT_TRACE_LEVEL_BLOCK
+#define DSP_TRACER_BLOCK(name) TRACER(name)
+#else
+#define DSP_TRACER_BLOCK(name)
+#endif
+
+#if DMT_DSP_TRACE_LEVEL >= DMT_TRACE_LEVEL_COMPONENT
+#define DSP_TRACER_COMPONENT(name) TRACER(name)
+#else
+#define DSP_TRACER_COMPONENT(name)
+#endif
+
+#if DMT_DSP_TRACE_LEVEL >= DMT_TRACE_LEVEL_SAMPLE
+#define DSP_TRACER_SAMPLE(name) TRACER(name)
+#else
+#define DSP_TRACER_SAMPLE(name)
+#endif
+
+//==============================================================================
+// GUI trace points
+
+#if DMT_GUI_TRACE_LEVEL >= DMT_TRACE_LEVEL_BLOCK
+#define GUI_TRACER_BLOCK(name) TRACER(name)
+#else
+#define GUI_TRACER_BLOCK(name)
+#endif
+
+#if DMT_GUI_TRACE_LEVEL >= DMT_TRACE_LEVEL_COMPONENT
+#define GUI_TRACER_COMPONENT(name) TRACER(name)
+#else
+#define GUI_TRACER_COMPONENT(name)
+#endif
+
+#if DMT_GUI_TRACE_LEVEL >= DMT_TRACE_LEVEL_SAMPLE
+#define GUI_TRACER_SAMPLE(name) TRACER(name)
+#else
+#define GUI_TRACER_SAMPLE(name)
+#endif
+
+//==============================================================================
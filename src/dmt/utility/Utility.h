@@ -29,12 +29,19 @@
 
 //==============================================================================
 
+#include "./FlightRecorder.h"
 #include "./Fonts.h"
+#include "./FrameScheduler.h"
 #include "./Icon.h"
+#include "./LoadMeter.h"
+#include "./LogWriter.h"
+#include "./Logger.h"
 #include "./Math.h"
+#include "./RenderScheduler.h"
 #include "./RepaintTimer.h"
 #include "./Scaleable.h"
 #include "./Settings.h"
+#include "./Tracer.h"
 #include "./Unit.h"
 
 //==============================================================================